@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include <algorithm>
+
+#include <lge_lights.h>
+
+#include "BacklightWorker.h"
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+BacklightWorker::BacklightWorker(std::chrono::milliseconds window) : mWindow(window) {
+    mThread = std::thread(&BacklightWorker::threadLoop, this);
+}
+
+BacklightWorker::~BacklightWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQuit = true;
+    }
+    mCond.notify_one();
+    mThread.join();
+}
+
+void BacklightWorker::post(int brightness, int brightnessEx) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (!mPending) {
+            mPending = true;
+            mFirstRequest = Clock::now();
+        }
+        mBrightness = brightness;
+        mBrightnessEx = brightnessEx;
+        mRequests++;
+    }
+    mCond.notify_one();
+}
+
+void BacklightWorker::threadLoop() {
+    pthread_setname_np(pthread_self(), "backlight");
+
+    std::unique_lock<std::mutex> lock(mLock);
+    for (;;) {
+        mCond.wait(lock, [this] { return mPending || mQuit; });
+        if (mQuit) {
+            return;
+        }
+
+        // Within a window of the previous write, let the rest of the burst land first.
+        mCond.wait_until(lock, mLastApply + mWindow, [this] { return mQuit; });
+        if (mQuit) {
+            return;
+        }
+
+        int brightness = mBrightness;
+        int brightnessEx = mBrightnessEx;
+        Clock::time_point firstRequest = mFirstRequest;
+        mPending = false;
+
+        lock.unlock();
+        bool ok = mSysfs.set(BL BRIGHTNESS, brightness);
+        ok &= mSysfs.set(BL_EX BRIGHTNESS, brightnessEx);
+        mLastApply = Clock::now();
+        Clock::duration latency = mLastApply - firstRequest;
+        lock.lock();
+
+        mApplied++;
+        if (!ok) {
+            mFailed++;
+        }
+        mTotalLatency += latency;
+        mMaxLatency = std::max(mMaxLatency, latency);
+    }
+}
+
+void BacklightWorker::dump(int fd) {
+    std::lock_guard<std::mutex> lock(mLock);
+
+    dprintf(fd, "Backlight worker (window %lldms)\n", (long long)mWindow.count());
+    dprintf(fd, "  requests=%llu applied=%llu failed=%llu\n", (unsigned long long)mRequests,
+            (unsigned long long)mApplied, (unsigned long long)mFailed);
+    dprintf(fd, "  apply latency avg=%lldus max=%lldus\n",
+            (long long)duration_cast<microseconds>(mTotalLatency).count() /
+                    (long long)std::max<uint64_t>(mApplied, 1),
+            (long long)duration_cast<microseconds>(mMaxLatency).count());
+    dprintf(fd, "  last brightness=%d brightness_ex=%d%s\n", mBrightness, mBrightnessEx,
+            mPending ? " (pending)" : "");
+}
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "SysfsWriter.h"
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+/*
+ * Applies backlight levels from a dedicated thread.
+ *
+ * post() only records the requested levels and returns. The worker writes at most once
+ * per coalescing window and always writes the level requested last, so an isolated
+ * update lands right away while a ramp costs one write per window instead of one per step.
+ */
+class BacklightWorker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit BacklightWorker(std::chrono::milliseconds window);
+    ~BacklightWorker();
+
+    void post(int brightness, int brightnessEx);
+    void dump(int fd);
+
+private:
+    void threadLoop();
+
+    const std::chrono::milliseconds mWindow;
+    // Only touched by the worker thread.
+    SysfsWriter mSysfs;
+
+    std::mutex mLock;
+    std::condition_variable mCond;
+    bool mPending = false;
+    bool mQuit = false;
+    int mBrightness = 0;
+    int mBrightnessEx = 0;
+    // Time of the oldest request not applied yet.
+    Clock::time_point mFirstRequest;
+    // Only touched by the worker thread.
+    Clock::time_point mLastApply;
+
+    // Statistics, guarded by mLock.
+    uint64_t mRequests = 0;
+    uint64_t mApplied = 0;
+    uint64_t mFailed = 0;
+    Clock::duration mTotalLatency = Clock::duration::zero();
+    Clock::duration mMaxLatency = Clock::duration::zero();
+
+    std::thread mThread;
+};
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <log/log.h>
+
+#include <android-base/stringprintf.h>
+
+#include "LedController.h"
+
+using ::android::base::StringPrintf;
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+LedController::LedController(const std::string& blinkPath, const std::string& onOffPath)
+    : mBlinkPath(blinkPath), mOnOffPath(onOffPath) {}
+
+std::shared_ptr<const LedController::Pattern> LedController::compile(uint32_t color, int onMS,
+                                                                     int offMS) {
+    color &= 0x00ffffff;
+    if (color == 0) {
+        return nullptr;
+    }
+
+    // Timings do not matter for a solid pattern
+    if (offMS <= 0) {
+        onMS = 0;
+        offMS = 0;
+    }
+
+    PatternKey key(color, onMS, offMS);
+    auto it = mCache.find(key);
+    if (it != mCache.end()) {
+        return it->second;
+    }
+
+    if (mCache.size() >= kMaxPatterns) {
+        // Drop the patterns no source is showing anymore.
+        for (auto entry = mCache.begin(); entry != mCache.end();) {
+            entry = entry->second.use_count() == 1 ? mCache.erase(entry) : std::next(entry);
+        }
+    }
+
+    auto pattern = std::make_shared<Pattern>();
+    pattern->blink = offMS > 0;
+    pattern->value = pattern->blink ? StringPrintf("0x%06x,%d,%d", color, onMS, offMS)
+                                    : StringPrintf("0x%06x", color);
+    mCache.emplace(key, pattern);
+    return pattern;
+}
+
+void LedController::apply(const std::shared_ptr<const Pattern>& pattern) {
+    if (pattern == nullptr) {
+        /* Lights off */
+        mSysfs.set(mBlinkPath, "0x0,-1,-1");
+        mSysfs.set(mOnOffPath, "0x0");
+    } else if (pattern->blink) {
+        ALOGD("%s: Using blink pattern: %s\n", __func__, pattern->value.c_str());
+        mSysfs.set(mBlinkPath, pattern->value);
+        // Either pattern node replaces whatever the other one programmed.
+        mSysfs.invalidate(mOnOffPath);
+    } else {
+        ALOGD("%s: Using onoff pattern: %s\n", __func__, pattern->value.c_str());
+        mSysfs.set(mOnOffPath, pattern->value);
+        mSysfs.invalidate(mBlinkPath);
+    }
+}
+
+void LedController::setState(Source source, uint32_t color, int onMs, int offMs) {
+    mSources[source] = compile(color, onMs, offMs);
+
+    std::shared_ptr<const Pattern> winner;
+    for (const auto& pattern : mSources) {
+        if (pattern != nullptr) {
+            winner = pattern;
+            break;
+        }
+    }
+
+    // Compiled patterns are unique per key, so pointer equality means the same pattern.
+    if (mAppliedValid && winner == mApplied) {
+        return;
+    }
+
+    apply(winner);
+    mApplied = winner;
+    mAppliedValid = true;
+}
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "SysfsWriter.h"
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+/*
+ * Drives the RGB LED shared by notifications, attention and battery.
+ *
+ * States are compiled once into the string the driver expects and cached by
+ * (color, onMs, offMs), with solid patterns folded into a single key per color.
+ * The LED shows the lit source with the highest priority, and the pattern nodes are
+ * only written when that pattern actually changes.
+ *
+ * The node paths are passed in so the controller can run against a fake sysfs tree.
+ * Not thread safe, callers serialise access.
+ */
+class LedController {
+public:
+    // In decreasing priority.
+    enum Source { NOTIFICATION, ATTENTION, BATTERY, SOURCE_COUNT };
+
+    LedController(const std::string& blinkPath, const std::string& onOffPath);
+
+    // color is 0xRRGGBB, 0 turns the source off. offMs <= 0 means solid.
+    void setState(Source source, uint32_t color, int onMs, int offMs);
+
+    size_t cachedPatterns() const { return mCache.size(); }
+
+private:
+    struct Pattern {
+        bool blink;
+        std::string value;
+    };
+
+    using PatternKey = std::tuple<uint32_t, int, int>;
+
+    // Bounds the cache for apps cycling through arbitrary colors.
+    static constexpr size_t kMaxPatterns = 64;
+
+    std::shared_ptr<const Pattern> compile(uint32_t color, int onMS, int offMS);
+    void apply(const std::shared_ptr<const Pattern>& pattern);
+
+    const std::string mBlinkPath;
+    const std::string mOnOffPath;
+    SysfsWriter mSysfs;
+
+    std::map<PatternKey, std::shared_ptr<const Pattern>> mCache;
+    // Pattern of each source, nullptr while the source is off.
+    std::array<std::shared_ptr<const Pattern>, SOURCE_COUNT> mSources;
+    std::shared_ptr<const Pattern> mApplied;
+    bool mAppliedValid = false;
+};
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
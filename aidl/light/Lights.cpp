@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <android-base/properties.h>
 #include <log/log.h>
 
 #include "Lights.h"
@@ -13,14 +14,8 @@ namespace android {
 namespace hardware {
 namespace light {
 
-/*
- * Write value to path and close file.
- */
-template <typename T>
-static void set(const std::string& path, const T& value) {
-    std::ofstream file(path);
-    file << value;
-}
+// Window in which a burst of backlight updates is folded into a single write
+static constexpr int BACKLIGHT_COALESCE_MS = 8;
 
 template <typename T>
 static T get(const std::string& path, const T& def) {
@@ -31,7 +26,11 @@ static T get(const std::string& path, const T& def) {
     return file.fail() ? def : result;
 }
 
-Lights::Lights() {
+Lights::Lights()
+#ifdef LED
+    : mLed(LED BLINK_PATTERN, LED ONOFF_PATTERN)
+#endif
+{
     auto backlightFn(std::bind(&Lights::handleBacklight, this, std::placeholders::_1));
     mLights.emplace(LightType::BACKLIGHT, backlightFn);
 
@@ -52,6 +51,10 @@ Lights::Lights() {
     if (mMaxBrightnessEx < 0) {
         mMaxBrightnessEx = 255;
     }
+
+    mBacklight = std::make_unique<BacklightWorker>(std::chrono::milliseconds(
+            ::android::base::GetIntProperty("ro.vendor.lights.hal.backlight.coalesce_ms",
+                                            BACKLIGHT_COALESCE_MS)));
 }
 
 static int rgbToBrightness(const HwLightState& state) {
@@ -62,14 +65,8 @@ static int rgbToBrightness(const HwLightState& state) {
 }
 
 #ifdef LED
-static bool isLit(const HwLightState& state) {
-    return (state.color & 0x00ffffff);
-}
-
-void Lights::setLightLocked(const HwLightState& state) {
+void Lights::setLed(LedController::Source source, const HwLightState& state) {
     int onMS, offMS;
-    uint32_t color;
-    char pattern[PAGE_SIZE];
 
     switch (state.flashMode) {
         case FlashMode::TIMED:
@@ -86,47 +83,19 @@ void Lights::setLightLocked(const HwLightState& state) {
             break;
     }
 
-    color = state.color & 0x00ffffff;
-
-    if (offMS <= 0) {
-        sprintf(pattern,"0x%06x", color);
-        ALOGD("%s: Using onoff pattern: inColor=0x%06x\n", __func__, color);
-        set(LED ONOFF_PATTERN, pattern);
-    } else {
-        sprintf(pattern,"0x%06x,%d,%d", color, onMS, offMS);
-        ALOGD("%s: Using blink pattern: inColor=0x%06x delay_on=%d, delay_off=%d\n",
-              __func__, color, onMS, offMS);
-        set(LED BLINK_PATTERN, pattern);
-    }
-}
-
-void Lights::checkLightStateLocked() {
-    if (isLit(mNotificationState)) {
-        setLightLocked(mNotificationState);
-    } else if (isLit(mAttentionState)) {
-        setLightLocked(mAttentionState);
-    } else if (isLit(mBatteryState)) {
-        setLightLocked(mBatteryState);
-    } else {
-        /* Lights off */
-        set(LED BLINK_PATTERN, "0x0,-1,-1");
-        set(LED ONOFF_PATTERN, "0x0");
-    }
+    mLed.setState(source, state.color, onMS, offMS);
 }
 
 void Lights::handleAttention(const HwLightState& state) {
-    mAttentionState = state;
-    checkLightStateLocked();
+    setLed(LedController::ATTENTION, state);
 }
 
 void Lights::handleBattery(const HwLightState& state) {
-    mBatteryState = state;
-    checkLightStateLocked();
+    setLed(LedController::BATTERY, state);
 }
 
 void Lights::handleNotifications(const HwLightState& state) {
-    mNotificationState = state;
-    checkLightStateLocked();
+    setLed(LedController::NOTIFICATION, state);
 }
 #endif // LED
 
@@ -140,8 +109,7 @@ void Lights::handleBacklight(const HwLightState& state) {
         brightness = sentBrightness * mMaxBrightness / 255;
         brightnessEx = sentBrightness * mMaxBrightnessEx / 255;
     }
-    set(BL BRIGHTNESS, brightness);
-    set(BL_EX BRIGHTNESS, brightnessEx);
+    mBacklight->post(brightness, brightnessEx);
 }
 
 ndk::ScopedAStatus Lights::setLightState(int32_t id, const HwLightState& state) {
@@ -171,6 +139,11 @@ ndk::ScopedAStatus Lights::getLights(std::vector<HwLight>* _aidl_return) {
     return ndk::ScopedAStatus::ok();
 }
 
+binder_status_t Lights::dump(int fd, const char** /* args */, uint32_t /* numArgs */) {
+    mBacklight->dump(fd);
+    return STATUS_OK;
+}
+
 } // namespace light
 } // namespace hardware
 } // namespace android
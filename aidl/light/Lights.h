@@ -14,6 +14,9 @@
 
 #include <lge_lights.h>
 
+#include "BacklightWorker.h"
+#include "LedController.h"
+
 using ::aidl::android::hardware::light::FlashMode;
 using ::aidl::android::hardware::light::HwLightState;
 using ::aidl::android::hardware::light::HwLight;
@@ -30,11 +33,11 @@ public:
 
     ndk::ScopedAStatus setLightState(int32_t id, const HwLightState& state) override;
     ndk::ScopedAStatus getLights(std::vector<HwLight>* _aidl_return) override;
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override;
 
    private:
 #ifdef LED
-    void setLightLocked(const HwLightState& state);
-    void checkLightStateLocked();
+    void setLed(LedController::Source source, const HwLightState& state);
     void handleAttention(const HwLightState& state);
     void handleBattery(const HwLightState& state);
     void handleNotifications(const HwLightState& state);
@@ -44,15 +47,16 @@ public:
     std::mutex globalLock;
 
 #ifdef LED
-    HwLightState mAttentionState;
-    HwLightState mBatteryState;
-    HwLightState mNotificationState;
+    // Guarded by globalLock.
+    LedController mLed;
 #endif // LED
 
     std::map<LightType, std::function<void(const HwLightState&)>> mLights;
 
     int mMaxBrightness = 255;
     int mMaxBrightnessEx = 255;
+
+    std::unique_ptr<BacklightWorker> mBacklight;
 };
 
 } // namespace light
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <log/log.h>
+
+#include "SysfsWriter.h"
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+SysfsWriter::~SysfsWriter() {
+    for (auto& [path, node] : mNodes) {
+        if (node.fd >= 0) {
+            close(node.fd);
+        }
+    }
+}
+
+bool SysfsWriter::set(const std::string& path, const std::string& value) {
+    Node& node = mNodes[path];
+
+    if (node.fd >= 0 && node.value == value) {
+        return true;
+    }
+
+    if (node.fd < 0) {
+        node.fd = TEMP_FAILURE_RETRY(open(path.c_str(), O_WRONLY | O_CLOEXEC));
+        if (node.fd < 0) {
+            ALOGE("%s: failed to open %s: %s (%u errors)", __func__, path.c_str(),
+                  strerror(errno), ++node.errors);
+            return false;
+        }
+    }
+
+    ssize_t written = TEMP_FAILURE_RETRY(pwrite(node.fd, value.c_str(), value.size(), 0));
+    if (written != (ssize_t)value.size()) {
+        ALOGE("%s: failed to write %s to %s: %s (%u errors)", __func__, value.c_str(),
+              path.c_str(), written < 0 ? strerror(errno) : "short write", ++node.errors);
+        // Reopen on the next write, the node may have been recreated.
+        close(node.fd);
+        node.fd = -1;
+        node.value.clear();
+        return false;
+    }
+
+    node.value = value;
+    return true;
+}
+
+bool SysfsWriter::set(const std::string& path, int value) {
+    return set(path, std::to_string(value));
+}
+
+void SysfsWriter::invalidate(const std::string& path) {
+    auto it = mNodes.find(path);
+    if (it != mNodes.end()) {
+        it->second.value.clear();
+    }
+}
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+
+/*
+ * Keeps sysfs nodes open across writes.
+ *
+ * Each node is opened on first use and rewritten in place with pwrite(), and a write
+ * is skipped when the node already holds the value. Not thread safe, callers serialise
+ * access.
+ */
+class SysfsWriter {
+public:
+    ~SysfsWriter();
+
+    bool set(const std::string& path, const std::string& value);
+    bool set(const std::string& path, int value);
+
+    // Forgets the cached value, for nodes the driver changes behind our back.
+    void invalidate(const std::string& path);
+
+private:
+    struct Node {
+        int fd = -1;
+        // Last value written successfully, empty when unknown.
+        std::string value;
+        unsigned errors = 0;
+    };
+
+    std::map<std::string, Node> mNodes;
+};
+
+} // namespace light
+} // namespace hardware
+} // namespace android
+} // namespace aidl
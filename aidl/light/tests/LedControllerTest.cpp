@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "LedController.h"
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace light {
+namespace {
+
+constexpr uint32_t kRed = 0xff0000;
+constexpr uint32_t kGreen = 0x00ff00;
+constexpr uint32_t kBlue = 0x0000ff;
+
+class LedControllerTest : public ::testing::Test {
+  protected:
+    LedControllerTest()
+        : mBlinkPath(std::string(mDir.path) + "/blink_patterns"),
+          mOnOffPath(std::string(mDir.path) + "/onoff_patterns") {
+        clear();
+        mLed = std::make_unique<LedController>(mBlinkPath, mOnOffPath);
+    }
+
+    // Empties both nodes, so that anything found in them afterwards was written since
+    void clear() {
+        ASSERT_TRUE(::android::base::WriteStringToFile("", mBlinkPath));
+        ASSERT_TRUE(::android::base::WriteStringToFile("", mOnOffPath));
+    }
+
+    std::string read(const std::string& path) {
+        std::string value;
+        EXPECT_TRUE(::android::base::ReadFileToString(path, &value));
+        return value;
+    }
+
+    TemporaryDir mDir;
+    const std::string mBlinkPath;
+    const std::string mOnOffPath;
+    std::unique_ptr<LedController> mLed;
+};
+
+TEST_F(LedControllerTest, WritesSolidAndBlinkPatterns) {
+    mLed->setState(LedController::BATTERY, kRed, 0, 0);
+    EXPECT_EQ("0xff0000", read(mOnOffPath));
+    EXPECT_EQ("", read(mBlinkPath));
+
+    clear();
+    mLed->setState(LedController::BATTERY, kGreen, 500, 2000);
+    EXPECT_EQ("0x00ff00,500,2000", read(mBlinkPath));
+    EXPECT_EQ("", read(mOnOffPath));
+}
+
+TEST_F(LedControllerTest, HighestPrioritySourceWins) {
+    mLed->setState(LedController::BATTERY, kRed, 0, 0);
+    EXPECT_EQ("0xff0000", read(mOnOffPath));
+
+    mLed->setState(LedController::ATTENTION, kGreen, 0, 0);
+    EXPECT_EQ("0x00ff00", read(mOnOffPath));
+
+    mLed->setState(LedController::NOTIFICATION, kBlue, 0, 0);
+    EXPECT_EQ("0x0000ff", read(mOnOffPath));
+
+    // Lower priority sources change underneath without showing
+    clear();
+    mLed->setState(LedController::BATTERY, kGreen, 0, 0);
+    mLed->setState(LedController::ATTENTION, kRed, 0, 0);
+    EXPECT_EQ("", read(mOnOffPath));
+    EXPECT_EQ("", read(mBlinkPath));
+}
+
+TEST_F(LedControllerTest, RepostingTheSameStateDoesNotWrite) {
+    mLed->setState(LedController::NOTIFICATION, kBlue, 1000, 1000);
+    EXPECT_EQ("0x0000ff,1000,1000", read(mBlinkPath));
+
+    clear();
+    for (int i = 0; i < 10; i++) {
+        mLed->setState(LedController::NOTIFICATION, kBlue, 1000, 1000);
+    }
+    EXPECT_EQ("", read(mBlinkPath));
+    EXPECT_EQ("", read(mOnOffPath));
+
+    // Solid patterns ignore the on time
+    mLed->setState(LedController::NOTIFICATION, kRed, 0, 0);
+    clear();
+    mLed->setState(LedController::NOTIFICATION, kRed, 300, 0);
+    EXPECT_EQ("", read(mOnOffPath));
+}
+
+TEST_F(LedControllerTest, TurningOffTheTopSourceFallsBack) {
+    mLed->setState(LedController::BATTERY, kRed, 0, 0);
+    mLed->setState(LedController::ATTENTION, kGreen, 500, 500);
+    mLed->setState(LedController::NOTIFICATION, kBlue, 0, 0);
+
+    clear();
+    mLed->setState(LedController::NOTIFICATION, 0, 0, 0);
+    EXPECT_EQ("0x00ff00,500,500", read(mBlinkPath));
+
+    clear();
+    mLed->setState(LedController::ATTENTION, 0, 0, 0);
+    EXPECT_EQ("0xff0000", read(mOnOffPath));
+
+    clear();
+    mLed->setState(LedController::BATTERY, 0, 0, 0);
+    EXPECT_EQ("0x0,-1,-1", read(mBlinkPath));
+    EXPECT_EQ("0x0", read(mOnOffPath));
+}
+
+TEST_F(LedControllerTest, CacheEvictsPatternsNoSourceShows) {
+    mLed->setState(LedController::BATTERY, kRed, 0, 0);
+
+    // Chatty app cycling colors until the cache is full
+    uint32_t color = 1;
+    while (mLed->cachedPatterns() < 64) {
+        mLed->setState(LedController::NOTIFICATION, color++, 0, 0);
+    }
+
+    // Only the battery pattern and the notification still on screen survive
+    mLed->setState(LedController::NOTIFICATION, color, 0, 0);
+    EXPECT_EQ(3u, mLed->cachedPatterns());
+
+    clear();
+    mLed->setState(LedController::NOTIFICATION, 0, 0, 0);
+    EXPECT_EQ("0xff0000", read(mOnOffPath));
+}
+
+}  // namespace
+}  // namespace light
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "TspdrvDevice.h"
+
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <linux/tspdrv.h>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace vibrator {
+
+bool TspdrvFdDevice::write(const void* frame, size_t size) {
+    return ::write(mFileDesc, frame, size) == (ssize_t)size;
+}
+
+bool TspdrvFdDevice::enableAmp(int32_t actuator) {
+    return ioctl(mFileDesc, TSPDRV_ENABLE_AMP, actuator) == 0;
+}
+
+bool TspdrvFdDevice::disableAmp(int32_t actuator) {
+    return ioctl(mFileDesc, TSPDRV_DISABLE_AMP, actuator) == 0;
+}
+
+}  // namespace vibrator
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace vibrator {
+
+/*
+ * The device I/O TspdrvStreamer needs, so that it can be driven against a fake on the host.
+ */
+class TspdrvDevice {
+public:
+    virtual ~TspdrvDevice() = default;
+
+    // Writes one SPI frame: actuator index, sample width, sample count and the samples.
+    virtual bool write(const void* frame, size_t size) = 0;
+    virtual bool enableAmp(int32_t actuator) = 0;
+    virtual bool disableAmp(int32_t actuator) = 0;
+};
+
+// Talks to the tspdrv kernel driver through an already configured file descriptor.
+class TspdrvFdDevice : public TspdrvDevice {
+public:
+    explicit TspdrvFdDevice(int32_t fileDesc) : mFileDesc(fileDesc) {}
+
+    bool write(const void* frame, size_t size) override;
+    bool enableAmp(int32_t actuator) override;
+    bool disableAmp(int32_t actuator) override;
+
+private:
+    const int32_t mFileDesc;
+};
+
+}  // namespace vibrator
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "TspdrvStreamer.h"
+
+#include <android-base/logging.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace vibrator {
+
+// How many buffer entries needed per ms
+static constexpr double BUFFER_ENTRIES_PER_MS = 8.21;
+
+// Output buffer size (immvibed uses 40 and not size of VIBE_OUTPUT_SAMPLE_SIZE)
+static constexpr int32_t OUTPUT_BUFFER_SIZE = 40;
+
+// Actuator index, sample width and sample count precede the samples of each frame
+static constexpr int32_t SPI_HEADER_SIZE = 3;
+
+// The sine table covers one period; the phase accumulator wraps at 2^32, so the top
+// SINE_TABLE_BITS bits of the phase index the table.
+static constexpr int32_t SINE_TABLE_BITS = 10;
+static constexpr uint32_t PHASE_STEP =
+        (uint32_t)(4294967296.0 / (2 * M_PI * BUFFER_ENTRIES_PER_MS));
+
+static const auto kSineTable = [] {
+    std::array<int8_t, 1 << SINE_TABLE_BITS> table;
+    for (size_t i = 0; i < table.size(); i++) {
+        table[i] = (int8_t)round(127 * sin(2 * M_PI * i / table.size()));
+    }
+    return table;
+}();
+
+static int64_t nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+static size_t samplesForDuration(int32_t durationMs) {
+    return durationMs > 0 ? (size_t)round(BUFFER_ENTRIES_PER_MS * durationMs) : 0;
+}
+
+TspdrvStreamer::CommandQueue::CommandQueue() {
+    for (size_t i = 0; i < kCapacity; i++) {
+        mSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool TspdrvStreamer::CommandQueue::push(Command&& command) {
+    size_t pos = mTail.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    for (;;) {
+        slot = &mSlots[pos % kCapacity];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Full: the streaming thread has not caught up with kCapacity commands.
+            return false;
+        } else {
+            pos = mTail.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->command = std::move(command);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool TspdrvStreamer::CommandQueue::pop(Command* command) {
+    size_t pos = mHead.load(std::memory_order_relaxed);
+    Slot& slot = mSlots[pos % kCapacity];
+
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if ((intptr_t)sequence - (intptr_t)(pos + 1) < 0) {
+        return false;
+    }
+
+    *command = std::move(slot.command);
+    slot.command = {};
+    slot.sequence.store(pos + kCapacity, std::memory_order_release);
+    mHead.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
+
+void TspdrvStreamer::Generator::reset(const std::vector<Segment>* segments) {
+    mSegments = segments;
+    mSegment = 0;
+    mPhase = 0;
+    mRemaining = segments->empty() ? 0 : samplesForDuration((*segments)[0].durationMs);
+
+    mTotalSamples = 0;
+    for (const auto& segment : *segments) {
+        mTotalSamples += samplesForDuration(segment.durationMs);
+    }
+}
+
+bool TspdrvStreamer::Generator::fill(uint8_t* out, size_t count) {
+    size_t i = 0;
+
+    while (i < count && mSegment < mSegments->size()) {
+        if (mRemaining == 0) {
+            if (++mSegment < mSegments->size()) {
+                mRemaining = samplesForDuration((*mSegments)[mSegment].durationMs);
+            }
+            continue;
+        }
+
+        int32_t amplitude = (*mSegments)[mSegment].amplitude;
+        for (; i < count && mRemaining > 0; i++, mRemaining--) {
+            // The vibration is a sine curve, the negative parts are 255 + negative value
+            int32_t sine = kSineTable[mPhase >> (32 - SINE_TABLE_BITS)];
+            out[i] = (uint8_t)(int8_t)(amplitude * sine / 127);
+            mPhase += PHASE_STEP;
+        }
+    }
+
+    if (i == 0) {
+        return false;
+    }
+
+    memset(out + i, 0, count - i);
+    return true;
+}
+
+TspdrvStreamer::TspdrvStreamer(std::shared_ptr<TspdrvDevice> device, int32_t numActuators)
+    : mDevice(std::move(device)), mNumActuators(numActuators) {
+    mEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (mEventFd < 0) {
+        PLOG(ERROR) << "Failed to create eventfd";
+    }
+
+    mThread = std::thread(&TspdrvStreamer::threadLoop, this);
+}
+
+TspdrvStreamer::~TspdrvStreamer() {
+    while (!post({Command::QUIT, {}, nullptr})) {
+        std::this_thread::yield();
+    }
+    mThread.join();
+    close(mEventFd);
+}
+
+bool TspdrvStreamer::play(std::vector<Segment> segments, Callback callback) {
+    return post({Command::PLAY, std::move(segments), std::move(callback)});
+}
+
+bool TspdrvStreamer::stop() {
+    return post({Command::STOP, {}, nullptr});
+}
+
+bool TspdrvStreamer::post(Command&& command) {
+    if (!mQueue.push(std::move(command))) {
+        LOG(ERROR) << "Vibrator command queue is full";
+        return false;
+    }
+
+    uint64_t value = 1;
+    if (write(mEventFd, &value, sizeof(value)) != sizeof(value)) {
+        PLOG(ERROR) << "Failed to wake up the streaming thread";
+    }
+    return true;
+}
+
+bool TspdrvStreamer::waitForCommand(int timeoutMs) {
+    struct pollfd pfd = {.fd = mEventFd, .events = POLLIN};
+    if (poll(&pfd, 1, timeoutMs) <= 0) {
+        return false;
+    }
+
+    uint64_t value;
+    read(mEventFd, &value, sizeof(value));
+    return true;
+}
+
+void TspdrvStreamer::disableAmps() {
+    for (int32_t i = 0; i < mNumActuators; i++) {
+        if (!mDevice->disableAmp(i)) {
+            LOG(ERROR) << "Failed to deactivate Actuator with index " << i;
+        }
+    }
+}
+
+bool TspdrvStreamer::writeChunk(int32_t actuator, const uint8_t* samples) {
+    char output[OUTPUT_BUFFER_SIZE + SPI_HEADER_SIZE];
+    memset(output, 0, sizeof(output));
+    output[0] = actuator;  // first byte is actuator index
+    output[1] = 8;  // per definition has to be 8
+    output[2] = OUTPUT_BUFFER_SIZE; // size of the following output buffer
+    memcpy(output + 3, samples, OUTPUT_BUFFER_SIZE);
+
+    // write the buffer to the device
+    if (!mDevice->write(output, sizeof(output))) {
+        LOG(ERROR) << "Failed to write samples for Actuator with index " << actuator;
+        return false;
+    }
+    if ((mChunk + 1) % 4 == 0) {
+        // every 4 buffers, but not the first if theres only 1, we send an ENABLE_AMP signal
+        if (!mDevice->enableAmp(actuator)) {
+            LOG(ERROR) << "Failed to activate Actuator with index " << actuator;
+            return false;
+        }
+    }
+    return true;
+}
+
+void TspdrvStreamer::finishVibration() {
+    mStreaming = false;
+
+    if (mCallback) {
+        auto callback = std::move(mCallback);
+        mCallback = nullptr;
+        callback();
+    }
+}
+
+void TspdrvStreamer::threadLoop() {
+    pthread_setname_np(pthread_self(), "vibrator-stream");
+
+    for (;;) {
+        Command command;
+        while (mQueue.pop(&command)) {
+            switch (command.type) {
+                case Command::QUIT:
+                    finishVibration();
+                    return;
+                case Command::STOP:
+                    finishVibration();
+                    disableAmps();
+                    break;
+                case Command::PLAY:
+                    finishVibration();
+                    // turn previous vibrations off
+                    disableAmps();
+
+                    mSegments = std::move(command.segments);
+                    mCallback = std::move(command.callback);
+                    mGenerator.reset(&mSegments);
+
+                    mEndTimeMs = nowMs();
+                    for (const auto& segment : mSegments) {
+                        mEndTimeMs += segment.durationMs;
+                    }
+
+                    // Amount of buffer arrays with size of OUTPUT_BUFFER_SIZE
+                    mNumChunks = (mGenerator.totalSamples() + OUTPUT_BUFFER_SIZE - 1) /
+                                 OUTPUT_BUFFER_SIZE;
+                    mActuator = 0;
+                    mChunk = 0;
+                    mStreaming = mNumChunks > 0;
+                    break;
+            }
+        }
+
+        if (mStreaming) {
+            // One chunk at a time, so that a new command takes effect right away.
+            uint8_t samples[OUTPUT_BUFFER_SIZE];
+            mGenerator.fill(samples, OUTPUT_BUFFER_SIZE);
+            if (!writeChunk(mActuator, samples)) {
+                finishVibration();
+                continue;
+            }
+
+            if (++mChunk == mNumChunks) {
+                mChunk = 0;
+                if (++mActuator < mNumActuators) {
+                    mGenerator.reset(&mSegments);
+                } else {
+                    mStreaming = false;
+                }
+            }
+            continue;
+        }
+
+        if (mCallback) {
+            int64_t remainingMs = mEndTimeMs - nowMs();
+            if (remainingMs <= 0) {
+                finishVibration();
+                continue;
+            }
+            waitForCommand(remainingMs);
+        } else {
+            waitForCommand(-1);
+        }
+    }
+}
+
+}  // namespace vibrator
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
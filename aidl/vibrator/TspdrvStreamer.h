@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "TspdrvDevice.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace vibrator {
+
+/*
+ * Streams sample data to the tspdrv device from a dedicated thread.
+ *
+ * Binder threads only post commands to a lock-free queue and return immediately. The
+ * streaming thread synthesises samples chunk by chunk from a precomputed sine table, so no
+ * buffer proportional to the vibration length is ever allocated. It notices cancellations
+ * between chunks and fires the completion callback once the vibration has ended.
+ */
+class TspdrvStreamer {
+public:
+    struct Segment {
+        int32_t durationMs;
+        // Peak of the sine wave, 0 for silence.
+        uint8_t amplitude;
+    };
+
+    using Callback = std::function<void()>;
+
+    TspdrvStreamer(std::shared_ptr<TspdrvDevice> device, int32_t numActuators);
+    ~TspdrvStreamer();
+
+    // Replaces whatever is playing. The callback, if any, fires on the streaming thread once
+    // this vibration ends, whether it ran to completion, was stopped or was replaced.
+    bool play(std::vector<Segment> segments, Callback callback);
+    bool stop();
+
+private:
+    struct Command {
+        enum Type { PLAY, STOP, QUIT } type;
+        std::vector<Segment> segments;
+        Callback callback;
+    };
+
+    // Bounded multi-producer, single-consumer queue. Each slot carries a sequence number
+    // telling producers and the consumer whose turn it is, so neither side takes a lock.
+    class CommandQueue {
+    public:
+        CommandQueue();
+        bool push(Command&& command);
+        bool pop(Command* command);
+
+    private:
+        static constexpr size_t kCapacity = 16;
+
+        struct Slot {
+            std::atomic<size_t> sequence;
+            Command command;
+        };
+
+        std::array<Slot, kCapacity> mSlots;
+        std::atomic<size_t> mHead = 0;
+        std::atomic<size_t> mTail = 0;
+    };
+
+    // Produces the sample stream of a list of segments.
+    class Generator {
+    public:
+        void reset(const std::vector<Segment>* segments);
+        // Fills up to count samples, padding with silence after the last segment. Returns
+        // false once the stream is exhausted.
+        bool fill(uint8_t* out, size_t count);
+        size_t totalSamples() const { return mTotalSamples; }
+
+    private:
+        const std::vector<Segment>* mSegments = nullptr;
+        size_t mSegment = 0;
+        size_t mRemaining = 0;
+        uint32_t mPhase = 0;
+        size_t mTotalSamples = 0;
+    };
+
+    bool post(Command&& command);
+    void threadLoop();
+    bool waitForCommand(int timeoutMs);
+    void disableAmps();
+    bool writeChunk(int32_t actuator, const uint8_t* samples);
+    void finishVibration();
+
+    const std::shared_ptr<TspdrvDevice> mDevice;
+    const int32_t mNumActuators;
+    int mEventFd;
+
+    CommandQueue mQueue;
+    std::thread mThread;
+
+    // Streaming thread state.
+    std::vector<Segment> mSegments;
+    Callback mCallback;
+    Generator mGenerator;
+    int32_t mActuator = 0;
+    int32_t mChunk = 0;
+    int32_t mNumChunks = 0;
+    bool mStreaming = false;
+    int64_t mEndTimeMs = 0;
+};
+
+}  // namespace vibrator
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -8,30 +8,21 @@
 #include "Vibrator.h"
 
 #include <android-base/logging.h>
-#include <thread>
 
-#include <cmath>
-#include <cstring>
 #include <cutils/properties.h>
 
-#include <linux/tspdrv.h>
+#include <map>
 
 namespace aidl {
 namespace android {
 namespace hardware {
 namespace vibrator {
 
-// How many buffer entries needed per ms
-static constexpr double BUFFER_ENTRIES_PER_MS = 8.21;
-
 // Default amplitude value
 // The vibration is a sine curve, the negative parts are 255 + negative value
 // So, 127 is the maximum before it starts going the other direction
 static constexpr uint8_t DEFAULT_AMPLITUDE = 80;
 
-// Output buffer size (immvibed uses 40 and not size of VIBE_OUTPUT_SAMPLE_SIZE)
-static constexpr int32_t OUTPUT_BUFFER_SIZE = 40;
-
 // Click effect in ms
 static constexpr int32_t WAVEFORM_CLICK_EFFECT_MS = 6;
 
@@ -44,10 +35,49 @@ static constexpr uint32_t WAVEFORM_DOUBLE_CLICK_EFFECT_MS = 135;
 // Heavy click effect in ms
 static constexpr uint32_t WAVEFORM_HEAVY_CLICK_EFFECT_MS = 8;
 
+// Longest delay allowed before a primitive of a composition
+static constexpr int32_t COMPOSE_DELAY_MAX_MS = 1000;
+
+// Most primitives allowed in a composition
+static constexpr int32_t COMPOSE_SIZE_MAX = 256;
+
+// Envelope of each primitive at full scale, as segments of constant amplitude.
+// compose() only scales and concatenates these, no waveform is built per call.
+static const std::map<CompositePrimitive, std::vector<TspdrvStreamer::Segment>>
+        kPrimitiveWaveforms = {
+                {CompositePrimitive::NOOP, {}},
+                {CompositePrimitive::CLICK, {{6, 127}}},
+                {CompositePrimitive::THUD, {{10, 127}, {10, 96}, {10, 64}, {10, 32}}},
+                {CompositePrimitive::SPIN,
+                 {{15, 48}, {15, 80}, {15, 112}, {15, 127}, {15, 112}, {15, 80}, {15, 48}}},
+                {CompositePrimitive::QUICK_RISE, {{10, 32}, {10, 64}, {10, 96}, {10, 127}}},
+                {CompositePrimitive::SLOW_RISE,
+                 {{25, 16}, {25, 32}, {25, 48}, {25, 64}, {25, 80}, {25, 96}, {25, 112},
+                  {25, 127}}},
+                {CompositePrimitive::QUICK_FALL, {{10, 127}, {10, 96}, {10, 64}, {10, 32}}},
+                {CompositePrimitive::LIGHT_TICK, {{2, 96}}},
+                {CompositePrimitive::LOW_TICK, {{3, 64}}},
+};
+
+// Runs on the streaming thread once the vibration has ended
+static TspdrvStreamer::Callback completionCallback(
+        const std::shared_ptr<IVibratorCallback>& callback) {
+    if (callback == nullptr) {
+        return nullptr;
+    }
+
+    return [callback] {
+        auto ret = callback->onComplete();
+        if (!ret.isOk()) {
+            LOG(ERROR) << "Failed to notify vibration completion: " << ret.getDescription();
+        }
+    };
+}
+
 ndk::ScopedAStatus Vibrator::getCapabilities(int32_t* _aidl_return) {
     LOG(VERBOSE) << "Vibrator reporting capabilities";
     *_aidl_return = IVibrator::CAP_ON_CALLBACK | IVibrator::CAP_PERFORM_CALLBACK |
-                    IVibrator::CAP_AMPLITUDE_CONTROL;
+                    IVibrator::CAP_AMPLITUDE_CONTROL | IVibrator::CAP_COMPOSE_EFFECTS;
     return ndk::ScopedAStatus::ok();
 }
 
@@ -64,17 +94,13 @@ Vibrator::Vibrator(int32_t file_desc, int32_t numActuators) {
     mHeavyClickDuration = property_get_int32(
         "ro.vendor.vibrator.hal.heavyclick.duration", WAVEFORM_HEAVY_CLICK_EFFECT_MS);
 
+    mStreamer = std::make_unique<TspdrvStreamer>(std::make_shared<TspdrvFdDevice>(mFile_desc),
+                                                 mNumActuators);
 }
 
 ndk::ScopedAStatus Vibrator::off() {
-    for(int32_t i = 0; i < mNumActuators; i++)
-    {
-        int32_t ret = ioctl(mFile_desc, TSPDRV_DISABLE_AMP, i);
-        if(ret != 0)
-        {
-            LOG(ERROR) << "Failed to deactivate Actuator with index " << i;
-            return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
-        }
+    if (!mStreamer->stop()) {
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
     }
 
     return ndk::ScopedAStatus::ok();
@@ -82,57 +108,9 @@ ndk::ScopedAStatus Vibrator::off() {
 
 ndk::ScopedAStatus Vibrator::on(int32_t timeoutMs,
                                 const std::shared_ptr<IVibratorCallback>& callback) {
-    // Calculate needed buffer entries
-    int32_t bufferSize = (int32_t) round(BUFFER_ENTRIES_PER_MS * timeoutMs); 
-    u_int8_t fullBuffer[bufferSize];
-
-    // turn previous vibrations off
-    off();
-
-    for(int32_t i = 0; i < bufferSize; i++)
-    {
-        // The vibration is a sine curve, the negative parts are 255 + negative value
-        fullBuffer[i] = (u_int8_t) (mCurrentAmplitude * sin(i/BUFFER_ENTRIES_PER_MS));
-    }
-
-    // Amount of buffer arrays with size of OUTPUT_BUFFER_SIZE
-    int32_t numBuffers = (int32_t) ceil((double)bufferSize / (double)OUTPUT_BUFFER_SIZE);
-    u_int8_t outputBuffers[numBuffers][OUTPUT_BUFFER_SIZE];
-    memset(outputBuffers, 0, sizeof(outputBuffers));  // zero the array before we fill it with values
-
-    for(int32_t i = 0; i < bufferSize; i++)
-    {
-        // split fullBuffer into multiple smaller buffers with size OUTPUT_BUFFER_SIZE
-        outputBuffers[i/OUTPUT_BUFFER_SIZE][i%OUTPUT_BUFFER_SIZE] = fullBuffer[i];
-    }
-
-
-    for(int32_t i = 0; i < mNumActuators; i++)
-    {
-        for(int32_t j = 0; j < numBuffers; j++)
-        {
-            char output[OUTPUT_BUFFER_SIZE + SPI_HEADER_SIZE];
-            memset(output, 0, sizeof(output));
-            output[0] = i;  // first byte is actuator index
-            output[1] = 8;  // per definition has to be 8
-            output[2] = OUTPUT_BUFFER_SIZE; // size of the following output buffer
-            for(int32_t k = 3; k < OUTPUT_BUFFER_SIZE+3; k++)
-            {
-                output[k] = outputBuffers[j][k-3];
-            }
-            // write the buffer to the device
-            write(mFile_desc, output, sizeof(output));
-            if((j+1) % 4 == 0)
-            {
-                // every 4 buffers, but not the first if theres only 1, we send an ENABLE_AMP signal
-                int32_t ret = ioctl(mFile_desc, TSPDRV_ENABLE_AMP, i);
-                if(ret != 0)
-                {
-                    LOG(ERROR) << "Failed to activate Actuator with index " << i;
-                    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
-                }
-            }
-        }
+    // The samples are written by the streaming thread, so this returns right away
+    if (!mStreamer->play({{timeoutMs, mCurrentAmplitude}}, completionCallback(callback))) {
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
     }
 
     return ndk::ScopedAStatus::ok();
@@ -159,9 +137,7 @@ static uint8_t convertEffectStrength(EffectStrength strength) {
 ndk::ScopedAStatus Vibrator::perform(Effect effect, EffectStrength strength,
                                      const std::shared_ptr<IVibratorCallback>& callback,
                                      int32_t* _aidl_return) {
-    ndk::ScopedAStatus status = ndk::ScopedAStatus::ok();
     uint32_t timeMS;
-    uint8_t currentAmplitude;
 
     switch (effect) {
     case Effect::CLICK:
@@ -181,14 +157,11 @@ ndk::ScopedAStatus Vibrator::perform(Effect effect, EffectStrength strength,
         return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
     }
 
-    // save current amplitude
-    currentAmplitude = mCurrentAmplitude;
-
-    mCurrentAmplitude = convertEffectStrength(strength);
-    on(timeMS, callback);
-
-    // restore current amplitude
-    mCurrentAmplitude = currentAmplitude;
+    if (!mStreamer->play({{(int32_t)timeMS, convertEffectStrength(strength)}},
+                         completionCallback(callback))) {
+        *_aidl_return = 0;
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
+    }
 
     *_aidl_return = (size_t)timeMS;
     return ndk::ScopedAStatus::ok();
@@ -212,26 +185,69 @@ ndk::ScopedAStatus Vibrator::setExternalControl(bool /* enabled */) {
     return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
 }
 
-ndk::ScopedAStatus Vibrator::getCompositionDelayMax(int32_t*  /* maxDelayMs */) {
-    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+ndk::ScopedAStatus Vibrator::getCompositionDelayMax(int32_t* maxDelayMs) {
+    *maxDelayMs = COMPOSE_DELAY_MAX_MS;
+    return ndk::ScopedAStatus::ok();
 }
 
-ndk::ScopedAStatus Vibrator::getCompositionSizeMax(int32_t* /* maxSize */) {
-    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+ndk::ScopedAStatus Vibrator::getCompositionSizeMax(int32_t* maxSize) {
+    *maxSize = COMPOSE_SIZE_MAX;
+    return ndk::ScopedAStatus::ok();
 }
 
-ndk::ScopedAStatus Vibrator::getSupportedPrimitives(std::vector<CompositePrimitive>* /* supported */) {
-    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+ndk::ScopedAStatus Vibrator::getSupportedPrimitives(std::vector<CompositePrimitive>* supported) {
+    supported->clear();
+    for (const auto& [primitive, envelope] : kPrimitiveWaveforms) {
+        supported->push_back(primitive);
+    }
+    return ndk::ScopedAStatus::ok();
 }
 
-ndk::ScopedAStatus Vibrator::getPrimitiveDuration(CompositePrimitive /* primitive */,
-                                                  int32_t* /* durationMs */) {
-    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+ndk::ScopedAStatus Vibrator::getPrimitiveDuration(CompositePrimitive primitive,
+                                                  int32_t* durationMs) {
+    auto it = kPrimitiveWaveforms.find(primitive);
+    if (it == kPrimitiveWaveforms.end()) {
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+    }
+
+    *durationMs = 0;
+    for (const auto& segment : it->second) {
+        *durationMs += segment.durationMs;
+    }
+    return ndk::ScopedAStatus::ok();
 }
 
-ndk::ScopedAStatus Vibrator::compose(const std::vector<CompositeEffect>& /* composite */,
-                                     const std::shared_ptr<IVibratorCallback>& /* callback */) {
-    return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+ndk::ScopedAStatus Vibrator::compose(const std::vector<CompositeEffect>& composite,
+                                     const std::shared_ptr<IVibratorCallback>& callback) {
+    if (composite.size() > (size_t)COMPOSE_SIZE_MAX) {
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_ILLEGAL_ARGUMENT));
+    }
+
+    std::vector<TspdrvStreamer::Segment> segments;
+    for (const auto& effect : composite) {
+        if (effect.delayMs < 0 || effect.delayMs > COMPOSE_DELAY_MAX_MS ||
+            effect.scale < 0.0f || effect.scale > 1.0f) {
+            return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_ILLEGAL_ARGUMENT));
+        }
+
+        auto it = kPrimitiveWaveforms.find(effect.primitive);
+        if (it == kPrimitiveWaveforms.end()) {
+            return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_UNSUPPORTED_OPERATION));
+        }
+
+        if (effect.delayMs > 0) {
+            segments.push_back({effect.delayMs, 0});
+        }
+        for (const auto& segment : it->second) {
+            segments.push_back({segment.durationMs, (uint8_t)(segment.amplitude * effect.scale)});
+        }
+    }
+
+    if (!mStreamer->play(std::move(segments), completionCallback(callback))) {
+        return ndk::ScopedAStatus(AStatus_fromExceptionCode(EX_TRANSACTION_FAILED));
+    }
+
+    return ndk::ScopedAStatus::ok();
 }
 
 ndk::ScopedAStatus Vibrator::getSupportedAlwaysOnEffects(std::vector<Effect>* /* _aidl_return */) {
@@ -9,6 +9,10 @@
 
 #include <aidl/android/hardware/vibrator/BnVibrator.h>
 
+#include "TspdrvStreamer.h"
+
+#include <memory>
+
 namespace aidl {
 namespace android {
 namespace hardware {
@@ -27,8 +31,8 @@ public:
     ndk::ScopedAStatus getSupportedEffects(std::vector<Effect>* _aidl_return) override;
     ndk::ScopedAStatus setAmplitude(float amplitude) override;
     ndk::ScopedAStatus setExternalControl(bool enabled) override;
-    ndk::ScopedAStatus getCompositionDelayMax(int32_t* maxDelayMs);
-    ndk::ScopedAStatus getCompositionSizeMax(int32_t* maxSize);
+    ndk::ScopedAStatus getCompositionDelayMax(int32_t* maxDelayMs) override;
+    ndk::ScopedAStatus getCompositionSizeMax(int32_t* maxSize) override;
     ndk::ScopedAStatus getSupportedPrimitives(std::vector<CompositePrimitive>* supported) override;
     ndk::ScopedAStatus getPrimitiveDuration(CompositePrimitive primitive,
                                             int32_t* durationMs) override;
@@ -57,6 +61,8 @@ private:
     int32_t mClickDuration;
     int32_t mTickDuration;
     int32_t mHeavyClickDuration;
+
+    std::unique_ptr<TspdrvStreamer> mStreamer;
 };
 
 }  // namespace vibrator
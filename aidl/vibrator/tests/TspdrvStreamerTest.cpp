@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "TspdrvStreamer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+
+using aidl::android::hardware::vibrator::TspdrvDevice;
+using aidl::android::hardware::vibrator::TspdrvStreamer;
+using Segment = TspdrvStreamer::Segment;
+
+namespace {
+
+constexpr size_t kSamplesPerFrame = 40;
+constexpr size_t kHeaderSize = 3;
+constexpr auto kTimeout = std::chrono::seconds(5);
+
+// Records everything the streamer sends to the driver.
+class FakeDevice : public TspdrvDevice {
+public:
+    struct Call {
+        enum Type { WRITE, ENABLE_AMP, DISABLE_AMP } type;
+        int32_t actuator;
+    };
+
+    bool write(const void* frame, size_t size) override {
+        std::lock_guard<std::mutex> lock(mLock);
+        const uint8_t* bytes = (const uint8_t*)frame;
+        mCalls.push_back({Call::WRITE, bytes[0]});
+        mFrames.emplace_back(bytes, bytes + size);
+        return mFailWrites == 0 || mFrames.size() < mFailWrites;
+    }
+
+    bool enableAmp(int32_t actuator) override {
+        std::lock_guard<std::mutex> lock(mLock);
+        mCalls.push_back({Call::ENABLE_AMP, actuator});
+        return true;
+    }
+
+    bool disableAmp(int32_t actuator) override {
+        std::lock_guard<std::mutex> lock(mLock);
+        mCalls.push_back({Call::DISABLE_AMP, actuator});
+        return true;
+    }
+
+    // Fails the nth write and every write after it.
+    void failWritesFrom(size_t n) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mFailWrites = n;
+    }
+
+    std::vector<Call> calls() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mCalls;
+    }
+
+    std::vector<std::vector<uint8_t>> frames() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mFrames;
+    }
+
+private:
+    std::mutex mLock;
+    std::vector<Call> mCalls;
+    std::vector<std::vector<uint8_t>> mFrames;
+    size_t mFailWrites = 0;
+};
+
+class Completion {
+public:
+    TspdrvStreamer::Callback callback() {
+        return [this] {
+            std::lock_guard<std::mutex> lock(mLock);
+            mCount++;
+            mCond.notify_all();
+        };
+    }
+
+    bool wait() {
+        std::unique_lock<std::mutex> lock(mLock);
+        return mCond.wait_for(lock, kTimeout, [this] { return mCount > 0; });
+    }
+
+    int count() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mCount;
+    }
+
+private:
+    std::mutex mLock;
+    std::condition_variable mCond;
+    int mCount = 0;
+};
+
+size_t samplesFor(int32_t durationMs) {
+    return (size_t)round(8.21 * durationMs);
+}
+
+// Segments as Vibrator::compose() builds them for a 20ms delay, a CLICK at half scale and a
+// QUICK_FALL at full scale.
+const std::vector<Segment> kComposition = {
+        {20, 0}, {6, 63}, {10, 127}, {10, 96}, {10, 64}, {10, 32},
+};
+
+class TspdrvStreamerTest : public ::testing::Test {
+protected:
+    void start(int32_t numActuators) {
+        mDevice = std::make_shared<FakeDevice>();
+        mStreamer = std::make_unique<TspdrvStreamer>(mDevice, numActuators);
+    }
+
+    // Stops the streaming thread so that the recorded calls no longer change.
+    void join() { mStreamer.reset(); }
+
+    std::shared_ptr<FakeDevice> mDevice;
+    std::unique_ptr<TspdrvStreamer> mStreamer;
+};
+
+TEST_F(TspdrvStreamerTest, StreamsComposition) {
+    start(1);
+
+    Completion completion;
+    auto startTime = std::chrono::steady_clock::now();
+    ASSERT_TRUE(mStreamer->play(kComposition, completion.callback()));
+    ASSERT_TRUE(completion.wait());
+
+    // The callback waits for the vibration to play out, not just for the samples to be written
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(60));
+
+    join();
+    EXPECT_EQ(completion.count(), 1);
+
+    size_t totalSamples = 0;
+    for (const auto& segment : kComposition) {
+        totalSamples += samplesFor(segment.durationMs);
+    }
+    size_t numFrames = (totalSamples + kSamplesPerFrame - 1) / kSamplesPerFrame;
+
+    auto frames = mDevice->frames();
+    ASSERT_EQ(frames.size(), numFrames);
+
+    std::vector<int8_t> stream;
+    for (const auto& frame : frames) {
+        ASSERT_EQ(frame.size(), kHeaderSize + kSamplesPerFrame);
+        EXPECT_EQ(frame[0], 0);
+        EXPECT_EQ(frame[1], 8);
+        EXPECT_EQ(frame[2], kSamplesPerFrame);
+        stream.insert(stream.end(), frame.begin() + kHeaderSize, frame.end());
+    }
+
+    // Each segment peaks at its amplitude and never goes beyond it
+    size_t offset = 0;
+    for (const auto& segment : kComposition) {
+        size_t count = samplesFor(segment.durationMs);
+        int32_t peak = 0;
+        for (size_t i = offset; i < offset + count; i++) {
+            peak = std::max(peak, std::abs((int32_t)stream[i]));
+        }
+        EXPECT_LE(peak, segment.amplitude) << "segment at sample " << offset;
+        EXPECT_GE(peak, segment.amplitude * 95 / 100) << "segment at sample " << offset;
+        offset += count;
+    }
+
+    // The last frame is padded with silence
+    for (size_t i = offset; i < stream.size(); i++) {
+        EXPECT_EQ(stream[i], 0) << "padding at sample " << i;
+    }
+}
+
+TEST_F(TspdrvStreamerTest, EnablesAmpEveryFourthFrame) {
+    start(2);
+
+    Completion completion;
+    ASSERT_TRUE(mStreamer->play(kComposition, completion.callback()));
+    ASSERT_TRUE(completion.wait());
+    join();
+
+    auto calls = mDevice->calls();
+    auto frames = mDevice->frames();
+    size_t framesPerActuator = frames.size() / 2;
+    ASSERT_EQ(frames.size() % 2, 0u);
+
+    // Both actuators are disabled before playing, then each gets the whole stream in turn
+    ASSERT_GE(calls.size(), 2u);
+    EXPECT_EQ(calls[0].type, FakeDevice::Call::DISABLE_AMP);
+    EXPECT_EQ(calls[1].type, FakeDevice::Call::DISABLE_AMP);
+
+    size_t written = 0;
+    for (size_t i = 2; i < calls.size(); i++) {
+        if (calls[i].type != FakeDevice::Call::WRITE) {
+            continue;
+        }
+        int32_t actuator = written / framesPerActuator;
+        EXPECT_EQ(calls[i].actuator, actuator);
+        written++;
+
+        if ((written - actuator * framesPerActuator) % 4 == 0) {
+            ASSERT_LT(i + 1, calls.size());
+            EXPECT_EQ(calls[i + 1].type, FakeDevice::Call::ENABLE_AMP);
+            EXPECT_EQ(calls[i + 1].actuator, actuator);
+        } else if (i + 1 < calls.size()) {
+            EXPECT_NE(calls[i + 1].type, FakeDevice::Call::ENABLE_AMP);
+        }
+    }
+    EXPECT_EQ(written, frames.size());
+
+    for (size_t i = 0; i < framesPerActuator; i++) {
+        EXPECT_TRUE(std::equal(frames[i].begin() + 1, frames[i].end(),
+                               frames[framesPerActuator + i].begin() + 1))
+                << "frame " << i;
+    }
+}
+
+TEST_F(TspdrvStreamerTest, StopCompletesRightAway) {
+    start(1);
+
+    Completion completion;
+    ASSERT_TRUE(mStreamer->play({{10000, 127}}, completion.callback()));
+    auto startTime = std::chrono::steady_clock::now();
+    ASSERT_TRUE(mStreamer->stop());
+    ASSERT_TRUE(completion.wait());
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, std::chrono::seconds(1));
+
+    join();
+    EXPECT_EQ(completion.count(), 1);
+    EXPECT_EQ(mDevice->calls().back().type, FakeDevice::Call::DISABLE_AMP);
+}
+
+TEST_F(TspdrvStreamerTest, ReplacingCompletesPreviousVibration) {
+    start(1);
+
+    Completion first, second;
+    ASSERT_TRUE(mStreamer->play({{10000, 127}}, first.callback()));
+    ASSERT_TRUE(mStreamer->play(kComposition, second.callback()));
+    ASSERT_TRUE(first.wait());
+    ASSERT_TRUE(second.wait());
+
+    join();
+    EXPECT_EQ(first.count(), 1);
+    EXPECT_EQ(second.count(), 1);
+}
+
+TEST_F(TspdrvStreamerTest, WriteFailureCompletesVibration) {
+    start(1);
+    mDevice->failWritesFrom(3);
+
+    Completion completion;
+    ASSERT_TRUE(mStreamer->play({{10000, 127}}, completion.callback()));
+    ASSERT_TRUE(completion.wait());
+
+    join();
+    EXPECT_EQ(completion.count(), 1);
+    EXPECT_EQ(mDevice->frames().size(), 3u);
+}
+
+}  // namespace
@@ -32,6 +32,11 @@ LOCAL_MODULE := audio_amplifier.lge
 LOCAL_MODULE_RELATIVE_PATH := hw
 LOCAL_SRC_FILES := \
     amplifier.c
+
+ifeq ($(BOARD_LGE_HAS_HIFI_QUAD_DAC), true)
+LOCAL_STATIC_LIBRARIES += \
+    libdacbackend.lge
+endif
 LOCAL_VENDOR_MODULE := true
 
 LOCAL_C_INCLUDES += \
@@ -8,9 +8,12 @@
 #define LOG_TAG "lge_amplifier"
 #define LOG_NDEBUG 0
 
+#include <pthread.h>
+#include <inttypes.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <sys/types.h>
+#include <time.h>
 
 #include <cutils/log.h>
 #include <cutils/properties.h>
@@ -23,6 +26,7 @@
 #include "platform.h"
 #include "platform_api.h"
 
+#include "dac_backend.h"
 #include "dac_plugin.h"
 
 typedef struct lge_amplifier_device {
@@ -30,8 +34,24 @@ typedef struct lge_amplifier_device {
     struct audio_device* adev;
     struct audio_usecase* usecase_tx;
     struct pcm* pcm_out;
-    bool hifi_dac_enabled;
-    bool hifi_dac_config_changed;
+#ifdef SUPPORT_HIFI_QUAD_DAC
+    dac_state_t dac;
+#endif
+#ifdef SUPPORT_EXT_AMPLIFIER
+    /*
+     * The VI feedback session is kept open for feedback_linger_ms after the speaker
+     * stops, so that short bursts (notifications, key clicks) reuse it. Lock order is
+     * adev->lock, then feedback_lock.
+     */
+    pthread_mutex_t feedback_lock;
+    pthread_cond_t feedback_cond;
+    pthread_t feedback_thread;
+    bool feedback_thread_started;
+    bool feedback_thread_exit;
+    bool feedback_active;
+    int feedback_linger_ms;
+    struct timespec feedback_close_at;
+#endif
 } lge_amplifier_device_t;
 
 #ifdef SUPPORT_EXT_AMPLIFIER
@@ -53,8 +73,18 @@ static int lge_amplifier_is_speaker(uint32_t snd_device) {
     return speaker;
 }
 
-int lge_amplifier_start_feedback(amplifier_device_t* device, uint32_t snd_device) {
-    lge_amplifier_device_t* lge_amplifier = (lge_amplifier_device_t*)device;
+/* How long the feedback session stays open once the speaker stops; 0 closes it right away */
+#define FEEDBACK_LINGER_MS_PROP "ro.vendor.audio.amp.feedback_linger_ms"
+#define FEEDBACK_LINGER_MS_DEFAULT 3000
+
+static int64_t lge_amplifier_elapsed_us(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000000LL + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+/* Called with feedback_lock held */
+static int lge_amplifier_open_feedback(lge_amplifier_device_t* lge_amplifier) {
     int pcm_dev_tx_id = 0, rc = 0;
     struct pcm_config pcm_config_lge_amplifier = {
             .channels = 2,
@@ -67,13 +97,6 @@ int lge_amplifier_start_feedback(amplifier_device_t* device, uint32_t snd_device
             .silence_threshold = 0,
     };
 
-    if (!lge_amplifier) {
-        ALOGE("%d: Invalid params", __LINE__);
-        return -EINVAL;
-    }
-
-    if (lge_amplifier->pcm_out || !lge_amplifier_is_speaker(snd_device)) return 0;
-
     lge_amplifier->usecase_tx = (struct audio_usecase*)calloc(1, sizeof(struct audio_usecase));
     if (!lge_amplifier->usecase_tx) {
         ALOGE("%d: failed to allocate usecase", __LINE__);
@@ -101,7 +124,7 @@ int lge_amplifier_start_feedback(amplifier_device_t* device, uint32_t snd_device
 
     lge_amplifier->pcm_out = pcm_open(lge_amplifier->adev->snd_card, pcm_dev_tx_id, PCM_IN,
                                       &pcm_config_lge_amplifier);
-    if (!(lge_amplifier->pcm_out || pcm_is_ready(lge_amplifier->pcm_out))) {
+    if (!lge_amplifier->pcm_out || !pcm_is_ready(lge_amplifier->pcm_out)) {
         ALOGE("%d: %s", __LINE__, pcm_get_error(lge_amplifier->pcm_out));
         rc = -EIO;
         goto error;
@@ -125,10 +148,93 @@ error:
     disable_snd_device(lge_amplifier->adev, lge_amplifier->usecase_tx->in_snd_device);
     disable_audio_route(lge_amplifier->adev, lge_amplifier->usecase_tx);
     free(lge_amplifier->usecase_tx);
+    lge_amplifier->usecase_tx = NULL;
 
     return rc;
 }
 
+/* Called with adev->lock and feedback_lock held */
+static void lge_amplifier_close_feedback(lge_amplifier_device_t* lge_amplifier) {
+    if (!lge_amplifier->pcm_out) return;
+
+    pcm_close(lge_amplifier->pcm_out);
+    lge_amplifier->pcm_out = NULL;
+
+    disable_snd_device(lge_amplifier->adev, SND_DEVICE_IN_CAPTURE_VI_FEEDBACK);
+
+    if (lge_amplifier->usecase_tx) {
+        list_remove(&lge_amplifier->usecase_tx->list);
+        disable_audio_route(lge_amplifier->adev, lge_amplifier->usecase_tx);
+        free(lge_amplifier->usecase_tx);
+        lge_amplifier->usecase_tx = NULL;
+    }
+}
+
+static void* lge_amplifier_feedback_thread(void* context) {
+    lge_amplifier_device_t* lge_amplifier = (lge_amplifier_device_t*)context;
+
+    pthread_mutex_lock(&lge_amplifier->feedback_lock);
+    while (!lge_amplifier->feedback_thread_exit) {
+        if (lge_amplifier->feedback_active || !lge_amplifier->pcm_out) {
+            pthread_cond_wait(&lge_amplifier->feedback_cond, &lge_amplifier->feedback_lock);
+            continue;
+        }
+
+        if (pthread_cond_timedwait(&lge_amplifier->feedback_cond, &lge_amplifier->feedback_lock,
+                                   &lge_amplifier->feedback_close_at) != ETIMEDOUT) {
+            continue;
+        }
+
+        // Closing touches the usecase list and the mixer, which need adev->lock first
+        pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+        pthread_mutex_lock(&lge_amplifier->adev->lock);
+        pthread_mutex_lock(&lge_amplifier->feedback_lock);
+
+        if (!lge_amplifier->feedback_active && lge_amplifier->pcm_out &&
+            lge_amplifier_elapsed_us(&lge_amplifier->feedback_close_at) >= 0) {
+            ALOGD("%s: speaker idle for %d ms, closing feedback session", __func__,
+                  lge_amplifier->feedback_linger_ms);
+            lge_amplifier_close_feedback(lge_amplifier);
+        }
+        pthread_mutex_unlock(&lge_amplifier->adev->lock);
+    }
+    pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+
+    return NULL;
+}
+
+int lge_amplifier_start_feedback(amplifier_device_t* device, uint32_t snd_device) {
+    lge_amplifier_device_t* lge_amplifier = (lge_amplifier_device_t*)device;
+    struct timespec start;
+    int rc = 0;
+
+    if (!lge_amplifier) {
+        ALOGE("%d: Invalid params", __LINE__);
+        return -EINVAL;
+    }
+
+    if (!lge_amplifier_is_speaker(snd_device)) return 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_mutex_lock(&lge_amplifier->feedback_lock);
+    if (lge_amplifier->feedback_active) goto done;
+
+    if (lge_amplifier->pcm_out) {
+        ALOGV("%s: reusing lingering feedback session", __func__);
+    } else {
+        rc = lge_amplifier_open_feedback(lge_amplifier);
+        if (rc < 0) goto done;
+        ALOGD("%s: feedback session opened in %" PRId64 " us", __func__,
+              lge_amplifier_elapsed_us(&start));
+    }
+    lge_amplifier->feedback_active = true;
+    pthread_cond_signal(&lge_amplifier->feedback_cond);
+
+done:
+    pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+    return rc;
+}
+
 void lge_amplifier_stop_feedback(amplifier_device_t* device, uint32_t snd_device) {
     lge_amplifier_device_t* lge_amplifier = (lge_amplifier_device_t*)device;
 
@@ -139,21 +245,63 @@ void lge_amplifier_stop_feedback(amplifier_device_t* device, uint32_t snd_device
 
     if (!lge_amplifier_is_speaker(snd_device)) return;
 
-    if (lge_amplifier->pcm_out) {
-        pcm_close(lge_amplifier->pcm_out);
-        lge_amplifier->pcm_out = NULL;
+    pthread_mutex_lock(&lge_amplifier->feedback_lock);
+    lge_amplifier->feedback_active = false;
+    if (!lge_amplifier->feedback_thread_started) {
+        lge_amplifier_close_feedback(lge_amplifier);
+    } else if (lge_amplifier->pcm_out) {
+        clock_gettime(CLOCK_MONOTONIC, &lge_amplifier->feedback_close_at);
+        lge_amplifier->feedback_close_at.tv_sec += lge_amplifier->feedback_linger_ms / 1000;
+        lge_amplifier->feedback_close_at.tv_nsec +=
+                (lge_amplifier->feedback_linger_ms % 1000) * 1000000L;
+        if (lge_amplifier->feedback_close_at.tv_nsec >= 1000000000L) {
+            lge_amplifier->feedback_close_at.tv_sec++;
+            lge_amplifier->feedback_close_at.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_signal(&lge_amplifier->feedback_cond);
     }
+    pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+}
 
-    disable_snd_device(lge_amplifier->adev, SND_DEVICE_IN_CAPTURE_VI_FEEDBACK);
+static void lge_amplifier_init_feedback(lge_amplifier_device_t* lge_amplifier) {
+    pthread_condattr_t attr;
+
+    pthread_mutex_init(&lge_amplifier->feedback_lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&lge_amplifier->feedback_cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    lge_amplifier->feedback_linger_ms =
+            property_get_int32(FEEDBACK_LINGER_MS_PROP, FEEDBACK_LINGER_MS_DEFAULT);
+    if (lge_amplifier->feedback_linger_ms > 0) {
+        lge_amplifier->feedback_thread_started =
+                pthread_create(&lge_amplifier->feedback_thread, NULL,
+                               lge_amplifier_feedback_thread, lge_amplifier) == 0;
+        if (!lge_amplifier->feedback_thread_started)
+            ALOGE("%s: failed to start feedback thread, not lingering", __func__);
+    }
+}
 
-    lge_amplifier->usecase_tx =
-            get_usecase_from_list(lge_amplifier->adev, USECASE_AUDIO_SPKR_CALIB_TX);
-    if (lge_amplifier->usecase_tx) {
-        list_remove(&lge_amplifier->usecase_tx->list);
-        disable_audio_route(lge_amplifier->adev, lge_amplifier->usecase_tx);
-        free(lge_amplifier->usecase_tx);
+static void lge_amplifier_deinit_feedback(lge_amplifier_device_t* lge_amplifier) {
+    if (lge_amplifier->feedback_thread_started) {
+        pthread_mutex_lock(&lge_amplifier->feedback_lock);
+        lge_amplifier->feedback_thread_exit = true;
+        pthread_cond_signal(&lge_amplifier->feedback_cond);
+        pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+        pthread_join(lge_amplifier->feedback_thread, NULL);
     }
-    return;
+
+    if (lge_amplifier->adev) {
+        pthread_mutex_lock(&lge_amplifier->adev->lock);
+        pthread_mutex_lock(&lge_amplifier->feedback_lock);
+        lge_amplifier_close_feedback(lge_amplifier);
+        pthread_mutex_unlock(&lge_amplifier->feedback_lock);
+        pthread_mutex_unlock(&lge_amplifier->adev->lock);
+    }
+
+    pthread_cond_destroy(&lge_amplifier->feedback_cond);
+    pthread_mutex_destroy(&lge_amplifier->feedback_lock);
 }
 
 static int lge_amplifier_set_feedback(amplifier_device_t* device, void* adev, uint32_t devices,
@@ -171,42 +319,44 @@ static int lge_amplifier_set_feedback(amplifier_device_t* device, void* adev, ui
 #endif  // SUPPORT_EXT_AMPLIFIER
 
 #ifdef SUPPORT_HIFI_QUAD_DAC
+#ifndef TARGET_LEGACY_UM
+static int ess_route_headphones(void* ctx, bool enable) {
+    struct audio_device* adev = (struct audio_device*)ctx;
+
+    if (enable) {
+        platform_set_snd_device_backend(SND_DEVICE_OUT_HEADPHONES, HIFI_DAC_BACKEND,
+                                        HIFI_DAC_INTERFACE);
+        audio_route_apply_and_update_path(adev->audio_route, ESS_HIFI_MODE_MIXER_PATH);
+    } else {
+        platform_set_snd_device_backend(SND_DEVICE_OUT_HEADPHONES, DEFAULT_BACKEND,
+                                        DEFAULT_INTERFACE);
+        audio_route_apply_and_update_path(adev->audio_route, ESS_BYPASS_MODE_MIXER_PATH);
+    }
+    return 0;
+}
+#endif
+
 static int lge_amplifier_set_output_devices(struct amplifier_device* device, uint32_t devices) {
     lge_amplifier_device_t* lge_amplifier = (lge_amplifier_device_t*)device;
-    bool want_to_enable_hifi_dac = property_get_bool("persist.vendor.audio.hifi.enabled", false);
 
-    ALOGD("%s: enter", __func__);
+    ALOGV("%s: enter", __func__);
     if (!lge_amplifier) {
         ALOGE("%s: Invalid parameter", __func__);
         return -EINVAL;
     }
 
-    ALOGD("%s: Current device: %u\n", __func__, devices);
     if (devices != SND_DEVICE_OUT_HEADPHONES) {
-        ALOGD("%s: not a Hi-Fi DAC scenario.", __func__);
+        ALOGV("%s: %u is not a Hi-Fi DAC scenario.", __func__, devices);
         return 0;
     }
 
-    if (!lge_amplifier->hifi_dac_config_changed) {
-        ALOGD("%s: Hi-Fi DAC config unchanged.", __func__);
-        return 0;
-    }
-
-    // If DAC is currently not enabled, but the prop is set to true, change paths
-    if (want_to_enable_hifi_dac) {
-        platform_set_snd_device_backend(SND_DEVICE_OUT_HEADPHONES, HIFI_DAC_BACKEND,
-                                        HIFI_DAC_INTERFACE);
-        audio_route_apply_and_update_path(lge_amplifier->adev->audio_route, ESS_HIFI_MODE_MIXER_PATH);
-        lge_amplifier->hifi_dac_enabled = true;
-    }
-    // In all other cases, go back to normal state
-    else {
-        platform_set_snd_device_backend(SND_DEVICE_OUT_HEADPHONES, DEFAULT_BACKEND,
-                                        DEFAULT_INTERFACE);
-        audio_route_apply_and_update_path(lge_amplifier->adev->audio_route, ESS_BYPASS_MODE_MIXER_PATH);
-        lge_amplifier->hifi_dac_enabled = false;
-    }
+#ifdef TARGET_LEGACY_UM
+    // The legacy audio HAL moves headphones onto its own Hi-Fi snd device, see
+    // check_and_enable_ess_hifi(); it uses the same backend and state through libdacbackend.
     return 0;
+#else
+    return dac_route_headphones(&lge_amplifier->dac, ess_route_headphones, lge_amplifier->adev);
+#endif
 }
 
 static int lge_amplifier_set_parameters(struct amplifier_device* device, struct str_parms* parms) {
@@ -246,28 +396,29 @@ static int lge_amplifier_set_parameters(struct amplifier_device* device, struct
     // Add parameters to enable/disable the Hi-Fi Quad DAC feature
     err = str_parms_get_str(parms, "hifi_dac", value, sizeof(value));
     if (err >= 0) {
+        bool enable;
         if (!strncmp(value, "on", 2)) {
-            if (lge_amplifier->hifi_dac_enabled) {
-                ALOGD("%s: already enabled!", __func__);
-                ret = -EINVAL;
-                goto done;
-            }
-            ALOGD("%s: enabling Hi-Fi Quad DAC.", __func__);
-            property_set("persist.vendor.audio.hifi.enabled", "true");
+            enable = true;
         } else if (!strncmp(value, "off", 3)) {
-            if (!lge_amplifier->hifi_dac_enabled) {
-                ALOGD("%s: already disabled!", __func__);
-                ret = -EINVAL;
-                goto done;
-            }
-            ALOGD("%s: disabling Hi-Fi Quad DAC.", __func__);
-            property_set("persist.vendor.audio.hifi.enabled", "false");
+            enable = false;
         } else {
             ALOGE("%s: Invalid parameter", __func__);
             ret = -EINVAL;
             goto done;
         }
 
+        err = dac_set_hifi_wanted(&lge_amplifier->dac, enable);
+        if (err == -EALREADY) {
+            ALOGD("%s: already %s!", __func__, enable ? "enabled" : "disabled");
+            ret = -EINVAL;
+            goto done;
+        } else if (err < 0) {
+            ALOGE("%s: no Hi-Fi DAC to switch %s", __func__, enable ? "on" : "off");
+            ret = err;
+            goto done;
+        }
+        ALOGD("%s: %s Hi-Fi Quad DAC.", __func__, enable ? "enabling" : "disabling");
+
         struct audio_usecase* usecase;
         struct listnode* node;
         list_for_each(node, &lge_amplifier->adev->usecase_list) {
@@ -289,11 +440,9 @@ static int lge_amplifier_set_parameters(struct amplifier_device* device, struct
                     The only way, in this HAL's context, to make that function return true, is
                     to set this variable to true
                 */
-                lge_amplifier->hifi_dac_config_changed = true;
                 usecase->stream.out->stream_config_changed = true;
                 // Trigger a switch to Hi-Fi DAC
                 select_devices(lge_amplifier->adev, usecase->id);
-                lge_amplifier->hifi_dac_config_changed = false;
                 usecase->stream.out->stream_config_changed = false;
                 goto done;
             }
@@ -321,6 +470,9 @@ static int lge_amplifier_calibrate(struct amplifier_device* device, void* adev)
 }
 
 static int lge_amplifier_dev_close(hw_device_t* device) {
+#ifdef SUPPORT_EXT_AMPLIFIER
+    if (device) lge_amplifier_deinit_feedback((lge_amplifier_device_t*)device);
+#endif
     if (device) free(device);
 
     return 0;
@@ -353,11 +505,13 @@ static int lge_amplifier_module_open(const hw_module_t* module, const char* name
 #endif
 #ifdef SUPPORT_EXT_AMPLIFIER
     lge_amplifier->amp_dev.set_feedback = lge_amplifier_set_feedback;
+    lge_amplifier_init_feedback(lge_amplifier);
 #endif
     lge_amplifier->amp_dev.calibrate = lge_amplifier_calibrate;
 
-    lge_amplifier->hifi_dac_enabled = false;
-    lge_amplifier->hifi_dac_config_changed = false;
+#ifdef SUPPORT_HIFI_QUAD_DAC
+    dac_init(&lge_amplifier->dac);
+#endif
     *device = (hw_device_t*)lge_amplifier;
 
     return 0;
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define LOG_TAG "lge_dac_backend"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cutils/log.h>
+#include <cutils/properties.h>
+
+#ifdef __ANDROID__
+#include <sys/system_properties.h>
+#endif
+
+#include "dac_backend.h"
+
+#define ESS_SYSFS_PATH "/sys/kernel/es9218_dac"
+
+static uint32_t ess_probe(void) {
+    if (access(ESS_SYSFS_PATH, F_OK) == 0) return DAC_CAP_HIFI_ROUTE;
+
+    if (errno == ENOENT) {
+        ALOGE("%s: %s not found, no Hi-Fi DAC", __func__, ESS_SYSFS_PATH);
+        return 0;
+    }
+
+    // Anything else (EACCES from a missing sepolicy rule) says nothing about the hardware
+    ALOGW("%s: cannot check %s: %s, assuming the DAC is present", __func__, ESS_SYSFS_PATH,
+          strerror(errno));
+    return DAC_CAP_HIFI_ROUTE;
+}
+
+static uint32_t sim_probe(void) {
+    return DAC_CAP_HIFI_ROUTE;
+}
+
+static const dac_backend_t dac_backends[] = {
+        {.name = "ess", .probe = ess_probe, .routes_audio = true},
+        {.name = "sim", .probe = sim_probe, .routes_audio = false},
+};
+
+static const void* system_find(const char* name) {
+#ifdef __ANDROID__
+    return __system_property_find(name);
+#else
+    return NULL;
+#endif
+}
+
+static uint32_t system_serial(const void* handle) {
+#ifdef __ANDROID__
+    return __system_property_serial((const prop_info*)handle);
+#else
+    return 0;
+#endif
+}
+
+static const dac_props_t system_props = {
+        .find = system_find,
+        .serial = system_serial,
+        .get = property_get,
+        .set = property_set,
+};
+
+/* Same spellings as property_get_bool() */
+static bool parse_bool(const char* value, bool default_value) {
+    if (!strcmp(value, "1") || !strcmp(value, "y") || !strcmp(value, "yes") ||
+        !strcmp(value, "on") || !strcmp(value, "true")) {
+        return true;
+    }
+    if (!strcmp(value, "0") || !strcmp(value, "n") || !strcmp(value, "no") ||
+        !strcmp(value, "off") || !strcmp(value, "false")) {
+        return false;
+    }
+    return default_value;
+}
+
+void dac_init(dac_state_t* state) {
+    dac_init_props(state, &system_props);
+}
+
+void dac_init_props(dac_state_t* state, const dac_props_t* props) {
+    char name[PROPERTY_VALUE_MAX];
+    size_t i;
+
+    memset(state, 0, sizeof(*state));
+    state->props = props;
+
+    props->get(DAC_BACKEND_PROP, name, dac_backends[0].name);
+    state->backend = &dac_backends[0];
+    for (i = 0; i < sizeof(dac_backends) / sizeof(dac_backends[0]); i++) {
+        if (!strcmp(name, dac_backends[i].name)) {
+            state->backend = &dac_backends[i];
+            break;
+        }
+    }
+
+    state->caps = state->backend->probe();
+    ALOGD("%s: using %s DAC backend, caps 0x%x", __func__, state->backend->name, state->caps);
+}
+
+bool dac_hifi_supported(const dac_state_t* state) {
+    return state->caps & DAC_CAP_HIFI_ROUTE;
+}
+
+bool dac_hifi_wanted(dac_state_t* state) {
+    char value[PROPERTY_VALUE_MAX];
+    uint32_t serial;
+
+    if (!state->hifi_prop) {
+        // Not set yet (or persistent properties are not loaded yet)
+        state->hifi_prop = state->props->find(DAC_HIFI_PROP);
+        if (!state->hifi_prop) return state->hifi_wanted;
+        state->hifi_prop_serial = state->props->serial(state->hifi_prop) - 1;
+    }
+
+    serial = state->props->serial(state->hifi_prop);
+    if (serial != state->hifi_prop_serial) {
+        state->hifi_prop_serial = serial;
+        state->props->get(DAC_HIFI_PROP, value, "false");
+        state->hifi_wanted = parse_bool(value, false);
+    }
+    return state->hifi_wanted;
+}
+
+int dac_set_hifi_wanted(dac_state_t* state, bool enable) {
+    if (!dac_hifi_supported(state)) return -ENODEV;
+    if (dac_hifi_wanted(state) == enable) return -EALREADY;
+
+    state->hifi_wanted = enable;
+    state->props->set(DAC_HIFI_PROP, enable ? "true" : "false");
+    return 0;
+}
+
+int dac_route_headphones(dac_state_t* state, dac_route_fn route, void* ctx) {
+    bool wanted;
+    int rc;
+
+    if (!dac_hifi_supported(state)) return 0;
+
+    wanted = dac_hifi_wanted(state);
+    if (wanted == state->hifi_enabled) {
+        ALOGV("%s: Hi-Fi DAC config unchanged.", __func__);
+        return 0;
+    }
+
+    if (state->backend->routes_audio) {
+        rc = route(ctx, wanted);
+        if (rc < 0) {
+            ALOGE("%s: %s backend failed to turn Hi-Fi %s: %d", __func__, state->backend->name,
+                  wanted ? "on" : "off", rc);
+            return rc;
+        }
+    } else {
+        ALOGI("%s: simulated DAC %s", __func__, wanted ? "on" : "off");
+    }
+
+    state->hifi_enabled = wanted;
+    ALOGD("%s: Hi-Fi DAC %s", __func__, wanted ? "enabled" : "disabled");
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * DAC backends
+ *
+ * A backend says whether an external DAC is present and whether moving the headphone
+ * route onto it does anything. The routing itself belongs to the audio HAL and is passed
+ * in as a callback; its board values (backends, interfaces, mixer paths) still come from
+ * dac_plugin.h, which device trees may override.
+ *
+ * This is built as libdacbackend.lge and linked by the amplifier, the legacy audio HAL
+ * and the DacControl service, so all of them agree on the backend and on the Hi-Fi state.
+ *
+ * The backend is picked with ro.vendor.audio.dac.backend:
+ *   "ess" (default) - ESS Sabre Hi-Fi Quad DAC
+ *   "sim"           - no hardware, only tracks and logs the state
+ */
+
+/* Capabilities reported by probe() */
+#define DAC_CAP_HIFI_ROUTE (1 << 0) /* headphones can be routed through the DAC */
+
+typedef struct dac_backend {
+    const char* name;
+    /* Returns the DAC_CAP_* flags of the hardware that is present, 0 if none */
+    uint32_t (*probe)(void);
+    /* False if routing changes are only tracked and logged */
+    bool routes_audio;
+} dac_backend_t;
+
+/* Property store access, replaceable so the state can run against a fake one */
+typedef struct dac_props {
+    /* Returns a handle to an existing property, NULL if it is not set yet */
+    const void* (*find)(const char* name);
+    /* Changes every time the property is set */
+    uint32_t (*serial)(const void* handle);
+    int (*get)(const char* name, char* value, const char* default_value);
+    int (*set)(const char* name, const char* value);
+} dac_props_t;
+
+/*
+ * Hi-Fi state as seen by one user of the DAC.
+ *
+ * hifi_wanted mirrors DAC_HIFI_PROP: dac_set_hifi_wanted() updates it directly and
+ * other writers are noticed through the property serial, so routing never parses the
+ * property. hifi_enabled is what the route callback currently has applied.
+ */
+typedef struct dac_state {
+    const dac_backend_t* backend;
+    const dac_props_t* props;
+    uint32_t caps;
+    const void* hifi_prop;
+    uint32_t hifi_prop_serial;
+    bool hifi_wanted;
+    bool hifi_enabled;
+} dac_state_t;
+
+/* Moves headphones onto the DAC or back, returns a negative errno on failure */
+typedef int (*dac_route_fn)(void* ctx, bool enable);
+
+#define DAC_BACKEND_PROP "ro.vendor.audio.dac.backend"
+#define DAC_HIFI_PROP "persist.vendor.audio.hifi.enabled"
+
+/* Picks and probes the backend using the system property store */
+void dac_init(dac_state_t* state);
+void dac_init_props(dac_state_t* state, const dac_props_t* props);
+bool dac_hifi_supported(const dac_state_t* state);
+bool dac_hifi_wanted(dac_state_t* state);
+int dac_set_hifi_wanted(dac_state_t* state, bool enable);
+int dac_route_headphones(dac_state_t* state, dac_route_fn route, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "dac_backend.h"
+
+namespace {
+
+// Property store shared by all the states of a test, like the system one is
+struct FakeProperty {
+    std::string value;
+    uint32_t serial = 0;
+};
+
+std::map<std::string, FakeProperty> gProps;
+
+const void* fakeFind(const char* name) {
+    auto it = gProps.find(name);
+    return it == gProps.end() ? nullptr : &it->second;
+}
+
+uint32_t fakeSerial(const void* handle) {
+    return static_cast<const FakeProperty*>(handle)->serial;
+}
+
+int fakeGet(const char* name, char* value, const char* default_value) {
+    auto it = gProps.find(name);
+    strcpy(value, it == gProps.end() ? default_value : it->second.value.c_str());
+    return strlen(value);
+}
+
+int fakeSet(const char* name, const char* value) {
+    FakeProperty& prop = gProps[name];
+    prop.value = value;
+    prop.serial++;
+    return 0;
+}
+
+const dac_props_t kFakeProps = {
+        .find = fakeFind,
+        .serial = fakeSerial,
+        .get = fakeGet,
+        .set = fakeSet,
+};
+
+struct Router {
+    int calls = 0;
+    bool enabled = false;
+    int rc = 0;
+
+    static int route(void* ctx, bool enable) {
+        Router* router = static_cast<Router*>(ctx);
+        router->calls++;
+        if (router->rc < 0) return router->rc;
+        router->enabled = enable;
+        return 0;
+    }
+};
+
+class DacBackendTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        gProps.clear();
+        fakeSet(DAC_BACKEND_PROP, "sim");
+        dac_init_props(&mState, &kFakeProps);
+    }
+
+    dac_state_t mState;
+    Router mRouter;
+};
+
+TEST_F(DacBackendTest, PicksSimBackend) {
+    ASSERT_NE(mState.backend, nullptr);
+    EXPECT_STREQ(mState.backend->name, "sim");
+    EXPECT_FALSE(mState.backend->routes_audio);
+    EXPECT_TRUE(dac_hifi_supported(&mState));
+}
+
+TEST_F(DacBackendTest, UnknownBackendFallsBackToEss) {
+    fakeSet(DAC_BACKEND_PROP, "nonexistent");
+    dac_init_props(&mState, &kFakeProps);
+
+    EXPECT_STREQ(mState.backend->name, "ess");
+    EXPECT_TRUE(mState.backend->routes_audio);
+}
+
+TEST_F(DacBackendTest, HifiOffUntilPropertyIsSet) {
+    EXPECT_FALSE(dac_hifi_wanted(&mState));
+    EXPECT_EQ(dac_route_headphones(&mState, Router::route, &mRouter), 0);
+    EXPECT_FALSE(mState.hifi_enabled);
+}
+
+TEST_F(DacBackendTest, SetWantedWritesPropertyOnce) {
+    EXPECT_EQ(dac_set_hifi_wanted(&mState, true), 0);
+    EXPECT_EQ(gProps[DAC_HIFI_PROP].value, "true");
+    EXPECT_EQ(gProps[DAC_HIFI_PROP].serial, 1u);
+    EXPECT_TRUE(dac_hifi_wanted(&mState));
+
+    EXPECT_EQ(dac_set_hifi_wanted(&mState, true), -EALREADY);
+    EXPECT_EQ(gProps[DAC_HIFI_PROP].serial, 1u);
+
+    EXPECT_EQ(dac_set_hifi_wanted(&mState, false), 0);
+    EXPECT_EQ(gProps[DAC_HIFI_PROP].value, "false");
+    EXPECT_FALSE(dac_hifi_wanted(&mState));
+}
+
+TEST_F(DacBackendTest, OtherWritersAreNoticed) {
+    // Another user of the library, e.g. DacControl next to the audio HAL
+    dac_state_t other;
+    dac_init_props(&other, &kFakeProps);
+
+    EXPECT_EQ(dac_set_hifi_wanted(&other, true), 0);
+    EXPECT_TRUE(dac_hifi_wanted(&mState));
+
+    fakeSet(DAC_HIFI_PROP, "off");
+    EXPECT_FALSE(dac_hifi_wanted(&mState));
+    fakeSet(DAC_HIFI_PROP, "1");
+    EXPECT_TRUE(dac_hifi_wanted(&mState));
+    fakeSet(DAC_HIFI_PROP, "garbage");
+    EXPECT_FALSE(dac_hifi_wanted(&mState));
+}
+
+TEST_F(DacBackendTest, SimBackendTracksRouteWithoutRouting) {
+    ASSERT_EQ(dac_set_hifi_wanted(&mState, true), 0);
+    EXPECT_EQ(dac_route_headphones(&mState, Router::route, &mRouter), 0);
+    EXPECT_TRUE(mState.hifi_enabled);
+
+    // Unchanged, nothing to do
+    EXPECT_EQ(dac_route_headphones(&mState, Router::route, &mRouter), 0);
+    EXPECT_TRUE(mState.hifi_enabled);
+
+    fakeSet(DAC_HIFI_PROP, "false");
+    EXPECT_EQ(dac_route_headphones(&mState, Router::route, &mRouter), 0);
+    EXPECT_FALSE(mState.hifi_enabled);
+
+    EXPECT_EQ(mRouter.calls, 0);
+}
+
+TEST_F(DacBackendTest, NoDacRefusesChanges) {
+    // There is no es9218 driver on the host
+    fakeSet(DAC_BACKEND_PROP, "ess");
+    dac_init_props(&mState, &kFakeProps);
+    ASSERT_FALSE(dac_hifi_supported(&mState));
+
+    EXPECT_EQ(dac_set_hifi_wanted(&mState, true), -ENODEV);
+    EXPECT_EQ(gProps.count(DAC_HIFI_PROP), 0u);
+
+    fakeSet(DAC_HIFI_PROP, "true");
+    EXPECT_EQ(dac_route_headphones(&mState, Router::route, &mRouter), 0);
+    EXPECT_FALSE(mState.hifi_enabled);
+    EXPECT_EQ(mRouter.calls, 0);
+}
+
+}  // namespace
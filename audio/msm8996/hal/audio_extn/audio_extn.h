@@ -42,6 +42,8 @@
 #include "adsp_hdlr.h"
 #include "ip_hdlr_intf.h"
 #include "battery_listener.h"
+#include "downmix.h"
+#include "voip_rx.h"
 
 #define AUDIO_PARAMETER_DUAL_MONO  "dual_mono"
 
@@ -1202,4 +1204,5 @@ void audio_extn_set_custom_mtmx_params(struct audio_device *adev,
                                         struct audio_usecase *usecase,
                                         bool enable);
 void audio_extn_set_cpu_affinity();
+
 #endif /* AUDIO_EXTN_H */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DOWNMIX_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DOWNMIX_SSE2
+#endif
+
+#include "downmix.h"
+
+/*
+ * Stereo to mono downmix, mono = (L + R) >> 1.
+ *
+ * The vector paths produce exactly what the scalar loop produces: the sum is
+ * halved with an arithmetic shift, i.e. rounded towards minus infinity, and
+ * cannot overflow. dst may be the same buffer as src; each block is loaded
+ * before the (shorter) output is stored over its start.
+ */
+
+void audio_extn_downmix_stereo_to_mono_16(int16_t *dst, const int16_t *src, size_t frames)
+{
+    size_t i = 0;
+
+#if defined(DOWNMIX_NEON)
+    for (; i + 8 <= frames; i += 8) {
+        int16x8x2_t lr = vld2q_s16(src + 2 * i);
+        vst1q_s16(dst + i, vhaddq_s16(lr.val[0], lr.val[1]));
+    }
+#elif defined(DOWNMIX_SSE2)
+    const __m128i ones = _mm_set1_epi16(1);
+
+    for (; i + 8 <= frames; i += 8) {
+        /* L + R of each frame as 32 bits, halved and packed back */
+        __m128i lo = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)(src + 2 * i)), ones);
+        __m128i hi = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)(src + 2 * i + 8)), ones);
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_packs_epi32(_mm_srai_epi32(lo, 1), _mm_srai_epi32(hi, 1)));
+    }
+#endif
+
+    for (; i < frames; i++)
+        dst[i] = (int16_t)(((int32_t)src[2 * i] + (int32_t)src[2 * i + 1]) >> 1);
+}
+
+void audio_extn_downmix_stereo_to_mono_32(int32_t *dst, const int32_t *src, size_t frames)
+{
+    size_t i = 0;
+
+#if defined(DOWNMIX_NEON)
+    for (; i + 4 <= frames; i += 4) {
+        int32x4x2_t lr = vld2q_s32(src + 2 * i);
+        vst1q_s32(dst + i, vhaddq_s32(lr.val[0], lr.val[1]));
+    }
+#elif defined(DOWNMIX_SSE2)
+    const __m128i one = _mm_set1_epi32(1);
+
+    for (; i + 4 <= frames; i += 4) {
+        __m128 a = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(src + 2 * i)));
+        __m128 b = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(src + 2 * i + 4)));
+        __m128i l = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i r = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        /* (L >> 1) + (R >> 1) + (L & R & 1) == (L + R) >> 1 without a 33 bit sum */
+        __m128i sum = _mm_add_epi32(_mm_srai_epi32(l, 1), _mm_srai_epi32(r, 1));
+        sum = _mm_add_epi32(sum, _mm_and_si128(_mm_and_si128(l, r), one));
+        _mm_storeu_si128((__m128i *)(dst + i), sum);
+    }
+#endif
+
+    for (; i < frames; i++)
+        dst[i] = (int32_t)(((int64_t)src[2 * i] + (int64_t)src[2 * i + 1]) >> 1);
+}
+
+/* 24 bit packed little endian; three byte samples do not map onto vector lanes */
+void audio_extn_downmix_stereo_to_mono_24(uint8_t *dst, const uint8_t *src, size_t frames)
+{
+    size_t i;
+    int32_t l, r, m;
+
+    for (i = 0; i < frames; i++, src += 6, dst += 3) {
+        /* Sign extend through the top byte of a 32 bit value */
+        l = (int32_t)((uint32_t)src[0] << 8 | (uint32_t)src[1] << 16 | (uint32_t)src[2] << 24) >> 8;
+        r = (int32_t)((uint32_t)src[3] << 8 | (uint32_t)src[4] << 16 | (uint32_t)src[5] << 24) >> 8;
+        m = (l + r) >> 1;
+        dst[0] = (uint8_t)m;
+        dst[1] = (uint8_t)(m >> 8);
+        dst[2] = (uint8_t)(m >> 16);
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_HW_EXTN_DOWNMIX_H
+#define AUDIO_HW_EXTN_DOWNMIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* mono = (L + R) >> 1; dst may be src */
+void audio_extn_downmix_stereo_to_mono_16(int16_t *dst, const int16_t *src, size_t frames);
+void audio_extn_downmix_stereo_to_mono_24(uint8_t *dst, const uint8_t *src, size_t frames);
+void audio_extn_downmix_stereo_to_mono_32(int32_t *dst, const int32_t *src, size_t frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUDIO_HW_EXTN_DOWNMIX_H */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "downmix.h"
+#include "downmix_reference.h"
+
+// Each kernel against the per sample loop it replaced, in place as out_write() runs it
+
+namespace {
+
+// kWidth elements of T make up one sample
+template <typename T, size_t kWidth, void (*Downmix)(T*, const T*, size_t)>
+void BM_Downmix(benchmark::State& state) {
+    size_t frames = state.range(0);
+    std::vector<T> buffer(2 * kWidth * frames);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = (T)(i * 2654435761u);
+    }
+
+    // Running over its own output changes the data, not the amount of work
+    for (auto _ : state) {
+        Downmix(buffer.data(), buffer.data(), frames);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * frames);
+}
+
+}  // namespace
+
+// 20ms at 48 kHz, and 5ms for the low latency period
+#define DOWNMIX_SIZES Arg(240)->Arg(960)
+
+BENCHMARK_TEMPLATE(BM_Downmix, int16_t, 1, referenceDownmix16)->DOWNMIX_SIZES;
+BENCHMARK_TEMPLATE(BM_Downmix, int16_t, 1, audio_extn_downmix_stereo_to_mono_16)->DOWNMIX_SIZES;
+BENCHMARK_TEMPLATE(BM_Downmix, uint8_t, 3, referenceDownmix24)->DOWNMIX_SIZES;
+BENCHMARK_TEMPLATE(BM_Downmix, uint8_t, 3, audio_extn_downmix_stereo_to_mono_24)->DOWNMIX_SIZES;
+BENCHMARK_TEMPLATE(BM_Downmix, int32_t, 1, referenceDownmix32)->DOWNMIX_SIZES;
+BENCHMARK_TEMPLATE(BM_Downmix, int32_t, 1, audio_extn_downmix_stereo_to_mono_32)->DOWNMIX_SIZES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The per sample loops the vector kernels replaced, kept as the reference they must match
+
+inline void referenceDownmix16(int16_t* dst, const int16_t* src, size_t frames) {
+    for (size_t i = 0; i < frames; i++) {
+        dst[i] = (int16_t)(((int32_t)src[2 * i] + (int32_t)src[2 * i + 1]) >> 1);
+    }
+}
+
+inline void referenceDownmix32(int32_t* dst, const int32_t* src, size_t frames) {
+    for (size_t i = 0; i < frames; i++) {
+        dst[i] = (int32_t)(((int64_t)src[2 * i] + (int64_t)src[2 * i + 1]) >> 1);
+    }
+}
+
+inline int32_t unpack24(const uint8_t* p) {
+    int32_t value = p[0] | p[1] << 8 | p[2] << 16;
+    return value & 0x800000 ? value - (1 << 24) : value;
+}
+
+inline void referenceDownmix24(uint8_t* dst, const uint8_t* src, size_t frames) {
+    for (size_t i = 0; i < frames; i++, src += 6, dst += 3) {
+        int32_t mono = (unpack24(src) + unpack24(src + 3)) >> 1;
+        dst[0] = (uint8_t)mono;
+        dst[1] = (uint8_t)(mono >> 8);
+        dst[2] = (uint8_t)(mono >> 16);
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "downmix.h"
+#include "downmix_reference.h"
+
+namespace {
+
+// Around every vector block size and tail length, plus one HAL buffer (20ms at 48 kHz)
+const size_t kFrameCounts[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 960};
+
+// Random samples, with the extremes mixed in so that sums overflow the sample type
+template <typename T>
+std::vector<T> makeSamples(size_t count, std::mt19937& rng) {
+    std::uniform_int_distribution<T> any(std::numeric_limits<T>::min(),
+                                         std::numeric_limits<T>::max());
+    std::uniform_int_distribution<int> pick(0, 3);
+    std::vector<T> samples(count);
+    for (auto& sample : samples) {
+        switch (pick(rng)) {
+            case 0:
+                sample = std::numeric_limits<T>::min();
+                break;
+            case 1:
+                sample = std::numeric_limits<T>::max();
+                break;
+            default:
+                sample = any(rng);
+                break;
+        }
+    }
+    return samples;
+}
+
+std::vector<uint8_t> makePacked24(size_t samples, std::mt19937& rng) {
+    auto values = makeSamples<int32_t>(samples, rng);
+    std::vector<uint8_t> packed(3 * samples);
+    for (size_t i = 0; i < samples; i++) {
+        // Top 24 bits, so that the extremes of the 32 bit values become the 24 bit ones
+        uint32_t value = (uint32_t)values[i] >> 8;
+        packed[3 * i] = (uint8_t)value;
+        packed[3 * i + 1] = (uint8_t)(value >> 8);
+        packed[3 * i + 2] = (uint8_t)(value >> 16);
+    }
+    return packed;
+}
+
+class DownmixTest : public ::testing::TestWithParam<size_t> {
+  protected:
+    std::mt19937 mRng{(std::mt19937::result_type)GetParam()};
+};
+
+TEST_P(DownmixTest, Matches16BitReference) {
+    size_t frames = GetParam();
+    auto src = makeSamples<int16_t>(2 * frames, mRng);
+    std::vector<int16_t> expected(frames), out(frames);
+    referenceDownmix16(expected.data(), src.data(), frames);
+
+    audio_extn_downmix_stereo_to_mono_16(out.data(), src.data(), frames);
+    EXPECT_EQ(expected, out);
+
+    audio_extn_downmix_stereo_to_mono_16(src.data(), src.data(), frames);
+    src.resize(frames);
+    EXPECT_EQ(expected, src);
+}
+
+TEST_P(DownmixTest, Matches24BitReference) {
+    size_t frames = GetParam();
+    auto src = makePacked24(2 * frames, mRng);
+    std::vector<uint8_t> expected(3 * frames), out(3 * frames);
+    referenceDownmix24(expected.data(), src.data(), frames);
+
+    audio_extn_downmix_stereo_to_mono_24(out.data(), src.data(), frames);
+    EXPECT_EQ(expected, out);
+
+    audio_extn_downmix_stereo_to_mono_24(src.data(), src.data(), frames);
+    src.resize(3 * frames);
+    EXPECT_EQ(expected, src);
+}
+
+TEST_P(DownmixTest, Matches32BitReference) {
+    size_t frames = GetParam();
+    auto src = makeSamples<int32_t>(2 * frames, mRng);
+    std::vector<int32_t> expected(frames), out(frames);
+    referenceDownmix32(expected.data(), src.data(), frames);
+
+    audio_extn_downmix_stereo_to_mono_32(out.data(), src.data(), frames);
+    EXPECT_EQ(expected, out);
+
+    audio_extn_downmix_stereo_to_mono_32(src.data(), src.data(), frames);
+    src.resize(frames);
+    EXPECT_EQ(expected, src);
+}
+
+INSTANTIATE_TEST_SUITE_P(FrameCounts, DownmixTest, ::testing::ValuesIn(kFrameCounts));
+
+// Rounds towards minus infinity like the shift in the reference, never towards zero
+TEST(DownmixRoundingTest, OddSumsRoundDown) {
+    const int16_t src16[] = {-1, 0, 1, 0, -32768, -32767, 32767, 32766};
+    int16_t out16[4];
+    audio_extn_downmix_stereo_to_mono_16(out16, src16, 4);
+    EXPECT_EQ(-1, out16[0]);
+    EXPECT_EQ(0, out16[1]);
+    EXPECT_EQ(-32768, out16[2]);
+    EXPECT_EQ(32766, out16[3]);
+
+    const int32_t src32[] = {-1, 0, 1, 0, INT32_MIN, INT32_MIN + 1, INT32_MAX, INT32_MAX - 1};
+    int32_t out32[4];
+    audio_extn_downmix_stereo_to_mono_32(out32, src32, 4);
+    EXPECT_EQ(-1, out32[0]);
+    EXPECT_EQ(0, out32[1]);
+    EXPECT_EQ(INT32_MIN, out32[2]);
+    EXPECT_EQ(INT32_MAX - 1, out32[3]);
+}
+
+}  // namespace
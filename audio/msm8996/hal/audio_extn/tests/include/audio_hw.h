@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Stands in for the HAL's audio_hw.h in host tests: only the parts of struct
+ * stream_out and tinyalsa the audio_extn helpers use, with the pcm calls left
+ * to the test to implement.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <system/audio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pcm;
+
+struct pcm_config {
+    unsigned int channels;
+    unsigned int rate;
+    unsigned int period_size;
+    unsigned int period_count;
+};
+
+struct voip_rx;
+
+struct stream_out {
+    struct pcm *pcm;
+    struct pcm_config config;
+    audio_format_t format;
+    struct voip_rx *voip_rx;
+};
+
+int pcm_write(struct pcm *pcm, const void *data, unsigned int count);
+int pcm_get_htimestamp(struct pcm *pcm, unsigned int *avail, struct timespec *tstamp);
+unsigned int pcm_get_buffer_size(struct pcm *pcm);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "audio_hw.h"
+#include "voip_rx.h"
+
+namespace {
+
+// 20ms of 16 kHz mono, the period compress VOIP runs at
+constexpr unsigned int kPeriodFrames = 320;
+constexpr size_t kFrameBytes = kPeriodFrames * sizeof(int16_t);
+constexpr unsigned int kBufferFrames = 4 * kPeriodFrames;
+
+struct FakePcm {
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<const void*> sources;
+    bool drained = false;
+    int error = 0;
+};
+
+FakePcm gPcm;
+
+}  // namespace
+
+extern "C" int pcm_write(struct pcm*, const void* data, unsigned int count) {
+    if (gPcm.error) return gPcm.error;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (unsigned int off = 0; off < count; off += kFrameBytes) {
+        gPcm.frames.emplace_back(bytes + off, bytes + off + kFrameBytes);
+    }
+    gPcm.sources.push_back(data);
+    return 0;
+}
+
+extern "C" int pcm_get_htimestamp(struct pcm*, unsigned int* avail, struct timespec*) {
+    *avail = gPcm.drained ? kBufferFrames : 0;
+    return 0;
+}
+
+extern "C" unsigned int pcm_get_buffer_size(struct pcm*) {
+    return kBufferFrames;
+}
+
+namespace {
+
+// Frame n is filled with n so that the order on the pcm side can be checked
+std::vector<uint8_t> makeFrames(uint8_t first, size_t count) {
+    std::vector<uint8_t> data(count * kFrameBytes);
+    for (size_t i = 0; i < count; i++) {
+        memset(data.data() + i * kFrameBytes, first + i, kFrameBytes);
+    }
+    return data;
+}
+
+// Each test stays well below the dozen back to back writes it takes for the
+// jitter estimate to raise the target depth by itself.
+class VoipRxTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        gPcm = FakePcm();
+        mOut = {};
+        mOut.config.channels = 1;
+        mOut.config.rate = 16000;
+        mOut.config.period_size = kPeriodFrames;
+        mOut.config.period_count = 4;
+        mOut.format = AUDIO_FORMAT_PCM_16_BIT;
+        ASSERT_EQ(0, audio_extn_voip_rx_start(&mOut));
+    }
+
+    void TearDown() override { audio_extn_voip_rx_release(&mOut); }
+
+    size_t write(const std::vector<uint8_t>& data, size_t offset, size_t bytes) {
+        size_t written = SIZE_MAX;
+        EXPECT_EQ(0, audio_extn_voip_rx_write(&mOut, data.data() + offset, bytes, &written));
+        return written;
+    }
+
+    size_t write(const std::vector<uint8_t>& data) { return write(data, 0, data.size()); }
+
+    struct stream_out mOut;
+};
+
+TEST_F(VoipRxTest, WholeFramesPassThroughUncopied) {
+    auto first = makeFrames(0, 1);
+    EXPECT_EQ(kFrameBytes, write(first));
+
+    auto second = makeFrames(1, 2);
+    EXPECT_EQ(2 * kFrameBytes, write(second));
+    ASSERT_EQ(3u, gPcm.frames.size());
+    EXPECT_EQ(second.data(), gPcm.sources.back());
+    EXPECT_EQ(0u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+TEST_F(VoipRxTest, ShortWritesAreAssembled) {
+    auto data = makeFrames(7, 1);
+
+    EXPECT_EQ(0u, write(data, 0, kFrameBytes / 2));
+    EXPECT_TRUE(gPcm.frames.empty());
+    EXPECT_EQ(10u, audio_extn_voip_rx_get_latency_ms(&mOut));
+
+    EXPECT_EQ(kFrameBytes, write(data, kFrameBytes / 2, kFrameBytes / 2));
+    ASSERT_EQ(1u, gPcm.frames.size());
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.end()), gPcm.frames[0]);
+    EXPECT_EQ(0u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+TEST_F(VoipRxTest, UnderrunHoldsFramesUntilTargetDepth) {
+    auto data = makeFrames(0, 4);
+    EXPECT_EQ(kFrameBytes, write(data, 0, kFrameBytes));
+
+    // The DSP ran dry and only half a frame came in: hold back two frames now
+    gPcm.drained = true;
+    EXPECT_EQ(0u, write(data, kFrameBytes, kFrameBytes / 2));
+    gPcm.drained = false;
+    EXPECT_EQ(0u, write(data, kFrameBytes + kFrameBytes / 2, kFrameBytes));
+    EXPECT_EQ(30u, audio_extn_voip_rx_get_latency_ms(&mOut));
+    EXPECT_EQ(1u, gPcm.frames.size());
+
+    EXPECT_EQ(2 * kFrameBytes, write(data, 2 * kFrameBytes + kFrameBytes / 2, kFrameBytes / 2));
+    ASSERT_EQ(3u, gPcm.frames.size());
+    EXPECT_EQ(1, gPcm.frames[1][0]);
+    EXPECT_EQ(2, gPcm.frames[2][0]);
+    EXPECT_EQ(0u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+TEST_F(VoipRxTest, LongWritesGoThroughWhole) {
+    // More frames than the pool holds, while still buffering after start
+    auto data = makeFrames(0, 10);
+    EXPECT_EQ(10 * kFrameBytes, write(data));
+    ASSERT_EQ(10u, gPcm.frames.size());
+    for (size_t i = 0; i < gPcm.frames.size(); i++) {
+        EXPECT_EQ(i, gPcm.frames[i][0]);
+    }
+    EXPECT_EQ(0u, audio_extn_voip_rx_get_latency_ms(&mOut));
+
+    // Same with half a frame pending in front of them
+    auto more = makeFrames(10, 10);
+    EXPECT_EQ(0u, write(more, 0, kFrameBytes / 2));
+    EXPECT_EQ(9 * kFrameBytes, write(more, kFrameBytes / 2, 9 * kFrameBytes));
+    EXPECT_EQ(19u, gPcm.frames.size());
+    EXPECT_EQ(10u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+TEST_F(VoipRxTest, OverrunDropsOnlyWhatTheDspRefused) {
+    gPcm.error = -EIO;
+    auto data = makeFrames(0, 10);
+    size_t written = SIZE_MAX;
+    EXPECT_EQ(-EIO, audio_extn_voip_rx_write(&mOut, data.data(), data.size(), &written));
+    EXPECT_EQ(0u, written);
+    EXPECT_EQ(160u, audio_extn_voip_rx_get_latency_ms(&mOut));
+
+    // The pool kept the newest frames, and even a short write sends them
+    gPcm.error = 0;
+    auto more = makeFrames(10, 1);
+    EXPECT_EQ(8 * kFrameBytes, write(more, 0, kFrameBytes / 2));
+    ASSERT_EQ(8u, gPcm.frames.size());
+    EXPECT_EQ(2, gPcm.frames[0][0]);
+    EXPECT_EQ(9, gPcm.frames[7][0]);
+    EXPECT_EQ(10u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+TEST_F(VoipRxTest, FailedWritesKeepFramesHeld) {
+    gPcm.error = -EIO;
+    auto data = makeFrames(0, 2);
+    size_t written = SIZE_MAX;
+    EXPECT_EQ(-EIO, audio_extn_voip_rx_write(&mOut, data.data(), data.size(), &written));
+    EXPECT_EQ(0u, written);
+    EXPECT_EQ(40u, audio_extn_voip_rx_get_latency_ms(&mOut));
+
+    // They go out ahead of the next frame
+    gPcm.error = 0;
+    EXPECT_EQ(3 * kFrameBytes, write(makeFrames(2, 1)));
+    ASSERT_EQ(3u, gPcm.frames.size());
+    EXPECT_EQ(0, gPcm.frames[0][0]);
+    EXPECT_EQ(2, gPcm.frames[2][0]);
+    EXPECT_EQ(0u, audio_extn_voip_rx_get_latency_ms(&mOut));
+}
+
+}  // namespace
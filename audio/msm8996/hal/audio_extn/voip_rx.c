@@ -0,0 +1,411 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "voip_rx"
+/*#define LOG_NDEBUG 0*/
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <log/log.h>
+#include <cutils/str_parms.h>
+
+#include "audio_hw.h"
+#include "voip_rx.h"
+
+/*
+ * Downlink path of VOIP_RX outputs.
+ *
+ * The DSP consumes one period per frame interval. Writes that carry whole
+ * frames go straight to the pcm device from the caller's buffer. Anything
+ * else (short writes from an app that is late, or frames held back while the
+ * buffer refills) is assembled in a pool of frames allocated when the stream
+ * starts, so nothing is allocated or dropped on the write path.
+ *
+ * Underrun: the DSP has drained and no whole frame is at hand. Frames are
+ * then held until the target depth is reached again, so the next late packet
+ * is absorbed instead of starving the DSP once more.
+ * Overrun: the DSP refuses frames and the pool fills up. The oldest frame is
+ * dropped to keep the added latency bounded.
+ *
+ * The target depth follows the jitter of the write intervals (smoothed as in
+ * RFC 3550) and is raised by one frame for each underrun, decaying again
+ * after a stretch of clean frames.
+ */
+
+#define VOIP_RX_POOL_FRAMES     8
+#define VOIP_RX_MAX_TARGET      4
+/* Clean frames (5s at 20ms) before an underrun boost is given back */
+#define VOIP_RX_DECAY_FRAMES    250
+
+#define AUDIO_PARAMETER_KEY_VOIP_RX_STATS       "voip_rx_stats"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_FRAMES      "voip_rx_frames"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_UNDERRUNS   "voip_rx_underruns"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_OVERRUNS    "voip_rx_overruns"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_SHORT       "voip_rx_short_writes"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_TARGET      "voip_rx_target_frames"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_JITTER      "voip_rx_jitter_us"
+#define AUDIO_PARAMETER_KEY_VOIP_RX_MAX_GAP     "voip_rx_max_interval_us"
+
+struct voip_rx_stats {
+    uint32_t frames;
+    uint32_t underruns;
+    uint32_t overruns;
+    uint32_t short_writes;
+    uint32_t target;
+    int64_t jitter_ns;
+    int64_t max_interval_ns;
+};
+
+struct voip_rx {
+    uint8_t *pool;
+    size_t frame_bytes;
+    int64_t frame_ns;
+
+    /* Complete frames waiting for the DSP, oldest at head */
+    unsigned int head;
+    unsigned int count;
+    /* Bytes of the frame being assembled after the complete ones */
+    size_t fill;
+
+    bool buffering;
+    unsigned int boost;
+    unsigned int clean_frames;
+
+    int64_t last_write_ns;
+    int64_t last_write_dur_ns;
+    int64_t jitter_ns;
+
+    /* Guards stats and held_ns, which are read without the stream lock */
+    pthread_mutex_t lock;
+    struct voip_rx_stats stats;
+    int64_t held_ns;
+};
+
+static int64_t voip_rx_now_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static uint8_t *voip_rx_slot(struct voip_rx *rx, unsigned int n)
+{
+    return rx->pool + ((rx->head + n) % VOIP_RX_POOL_FRAMES) * rx->frame_bytes;
+}
+
+static unsigned int voip_rx_target(struct voip_rx *rx)
+{
+    unsigned int target = 1 + (unsigned int)(2 * rx->jitter_ns / rx->frame_ns) + rx->boost;
+
+    return target > VOIP_RX_MAX_TARGET ? VOIP_RX_MAX_TARGET : target;
+}
+
+static void voip_rx_update_timing(struct voip_rx *rx, size_t bytes, int64_t now)
+{
+    int64_t interval, deviation;
+
+    if (rx->last_write_ns) {
+        interval = now - rx->last_write_ns;
+        deviation = interval - rx->last_write_dur_ns;
+        if (deviation < 0)
+            deviation = -deviation;
+        rx->jitter_ns += (deviation - rx->jitter_ns) / 16;
+
+        pthread_mutex_lock(&rx->lock);
+        if (interval > rx->stats.max_interval_ns)
+            rx->stats.max_interval_ns = interval;
+        rx->stats.jitter_ns = rx->jitter_ns;
+        pthread_mutex_unlock(&rx->lock);
+    }
+
+    rx->last_write_ns = now;
+    rx->last_write_dur_ns = rx->frame_ns * (int64_t)bytes / (int64_t)rx->frame_bytes;
+}
+
+/* True when the DSP has played out everything it was given */
+static bool voip_rx_dsp_drained(struct stream_out *out)
+{
+    unsigned int avail;
+    struct timespec ts;
+
+    if (pcm_get_htimestamp(out->pcm, &avail, &ts) < 0)
+        return false;
+
+    return avail >= pcm_get_buffer_size(out->pcm);
+}
+
+static void voip_rx_update_held(struct voip_rx *rx)
+{
+    pthread_mutex_lock(&rx->lock);
+    rx->held_ns = rx->frame_ns * rx->count +
+                  rx->frame_ns * (int64_t)rx->fill / (int64_t)rx->frame_bytes;
+    pthread_mutex_unlock(&rx->lock);
+}
+
+static void voip_rx_account(struct voip_rx *rx, uint32_t frames)
+{
+    rx->clean_frames += frames;
+    if (rx->boost && rx->clean_frames >= VOIP_RX_DECAY_FRAMES) {
+        rx->boost--;
+        rx->clean_frames = 0;
+    }
+
+    pthread_mutex_lock(&rx->lock);
+    rx->stats.frames += frames;
+    rx->stats.target = voip_rx_target(rx);
+    pthread_mutex_unlock(&rx->lock);
+}
+
+/* Hands the held frames to the DSP once the target depth is reached */
+static int voip_rx_drain(struct stream_out *out, struct voip_rx *rx, size_t *written)
+{
+    int ret = 0;
+
+    if (rx->buffering) {
+        if (rx->count < voip_rx_target(rx))
+            return 0;
+        rx->buffering = false;
+    }
+
+    while (rx->count) {
+        ret = pcm_write(out->pcm, voip_rx_slot(rx, 0), rx->frame_bytes);
+        if (ret != 0)
+            break;
+        rx->head = (rx->head + 1) % VOIP_RX_POOL_FRAMES;
+        rx->count--;
+        *written += rx->frame_bytes;
+        voip_rx_account(rx, 1);
+    }
+
+    return ret;
+}
+
+/*
+ * Assembles frames and, if drain is set, drains each one as it completes, so
+ * the pool only fills up while the DSP refuses frames.
+ */
+static int voip_rx_push(struct stream_out *out, struct voip_rx *rx,
+                        const uint8_t *data, size_t bytes, bool drain, size_t *written)
+{
+    size_t n;
+    uint32_t dropped = 0;
+    int ret = 0;
+
+    while (bytes) {
+        if (rx->count == VOIP_RX_POOL_FRAMES) {
+            /* Overrun: make room by dropping the oldest frame */
+            rx->head = (rx->head + 1) % VOIP_RX_POOL_FRAMES;
+            rx->count--;
+            dropped++;
+        }
+
+        n = rx->frame_bytes - rx->fill;
+        if (n > bytes)
+            n = bytes;
+        memcpy(voip_rx_slot(rx, rx->count) + rx->fill, data, n);
+        rx->fill += n;
+        data += n;
+        bytes -= n;
+
+        if (rx->fill == rx->frame_bytes) {
+            rx->count++;
+            rx->fill = 0;
+            /* After a failed write, keep the rest for the next call */
+            if (drain && ret == 0)
+                ret = voip_rx_drain(out, rx, written);
+        }
+    }
+
+    if (dropped) {
+        ALOGW("%s: overrun, dropped %u frame(s)", __func__, dropped);
+        pthread_mutex_lock(&rx->lock);
+        rx->stats.overruns += dropped;
+        pthread_mutex_unlock(&rx->lock);
+    }
+
+    return ret;
+}
+
+int audio_extn_voip_rx_start(struct stream_out *out)
+{
+    struct voip_rx *rx = out->voip_rx;
+    size_t frame_bytes = out->config.period_size * out->config.channels *
+                         audio_bytes_per_sample(out->format);
+
+    if (frame_bytes == 0 || out->config.rate == 0)
+        return -EINVAL;
+
+    if (rx == NULL) {
+        rx = (struct voip_rx *)calloc(1, sizeof(struct voip_rx));
+        if (rx == NULL)
+            return -ENOMEM;
+        pthread_mutex_init(&rx->lock, (const pthread_mutexattr_t *) NULL);
+        out->voip_rx = rx;
+    }
+
+    /* The frame size follows the call's sample rate, which may change between calls */
+    if (rx->frame_bytes != frame_bytes) {
+        free(rx->pool);
+        rx->pool = (uint8_t *)malloc(frame_bytes * VOIP_RX_POOL_FRAMES);
+        if (rx->pool == NULL) {
+            rx->frame_bytes = 0;
+            return -ENOMEM;
+        }
+        rx->frame_bytes = frame_bytes;
+    }
+
+    rx->frame_ns = (int64_t)out->config.period_size * 1000000000LL / out->config.rate;
+    rx->head = 0;
+    rx->count = 0;
+    rx->fill = 0;
+    rx->buffering = true;
+    rx->boost = 0;
+    rx->clean_frames = 0;
+    rx->last_write_ns = 0;
+    rx->last_write_dur_ns = 0;
+    rx->jitter_ns = 0;
+    voip_rx_update_held(rx);
+
+    ALOGD("%s: frame %zu bytes, %" PRId64 " us", __func__,
+          rx->frame_bytes, rx->frame_ns / 1000);
+    return 0;
+}
+
+void audio_extn_voip_rx_release(struct stream_out *out)
+{
+    struct voip_rx *rx = out->voip_rx;
+
+    if (rx == NULL)
+        return;
+
+    out->voip_rx = NULL;
+    pthread_mutex_destroy(&rx->lock);
+    free(rx->pool);
+    free(rx);
+}
+
+int audio_extn_voip_rx_write(struct stream_out *out, const void *buffer, size_t bytes,
+                             size_t *written)
+{
+    struct voip_rx *rx = out->voip_rx;
+    int64_t now = voip_rx_now_ns();
+    int ret = 0, rc;
+
+    *written = 0;
+
+    if (rx == NULL || rx->pool == NULL) {
+        ret = pcm_write(out->pcm, buffer, bytes);
+        if (ret == 0)
+            *written = bytes;
+        return ret;
+    }
+
+    voip_rx_update_timing(rx, bytes, now);
+
+    if (bytes % rx->frame_bytes) {
+        pthread_mutex_lock(&rx->lock);
+        rx->stats.short_writes++;
+        pthread_mutex_unlock(&rx->lock);
+    }
+
+    /* Steady state: whole frames and nothing held back, hand them over as they are */
+    if (!rx->buffering && rx->count == 0 && rx->fill == 0 &&
+        bytes % rx->frame_bytes == 0) {
+        ret = pcm_write(out->pcm, buffer, bytes);
+        if (ret == 0) {
+            *written = bytes;
+            voip_rx_account(rx, bytes / rx->frame_bytes);
+        }
+        return ret;
+    }
+
+    if (!rx->buffering && rx->count == 0 && rx->fill + bytes < rx->frame_bytes &&
+        voip_rx_dsp_drained(out)) {
+        /* Underrun: rebuild some depth before feeding the DSP again */
+        if (rx->boost < VOIP_RX_MAX_TARGET)
+            rx->boost++;
+        rx->clean_frames = 0;
+        rx->buffering = true;
+        ALOGW("%s: underrun, holding %u frame(s)", __func__, voip_rx_target(rx));
+
+        pthread_mutex_lock(&rx->lock);
+        rx->stats.underruns++;
+        rx->stats.target = voip_rx_target(rx);
+        pthread_mutex_unlock(&rx->lock);
+    }
+
+    /* Frames left over from a failed write go first */
+    if (rx->count)
+        ret = voip_rx_drain(out, rx, written);
+
+    rc = voip_rx_push(out, rx, (const uint8_t *)buffer, bytes, ret == 0, written);
+    if (ret == 0)
+        ret = rc;
+
+    voip_rx_update_held(rx);
+    return ret;
+}
+
+uint32_t audio_extn_voip_rx_get_latency_ms(struct stream_out *out)
+{
+    struct voip_rx *rx = out->voip_rx;
+    int64_t held_ns;
+
+    if (rx == NULL)
+        return 0;
+
+    pthread_mutex_lock(&rx->lock);
+    held_ns = rx->held_ns;
+    pthread_mutex_unlock(&rx->lock);
+
+    return (uint32_t)(held_ns / 1000000);
+}
+
+void audio_extn_voip_rx_get_parameters(struct stream_out *out,
+                                       struct str_parms *query,
+                                       struct str_parms *reply)
+{
+    struct voip_rx *rx = out->voip_rx;
+    struct voip_rx_stats stats;
+    char value[32];
+
+    if (str_parms_get_str(query, AUDIO_PARAMETER_KEY_VOIP_RX_STATS,
+                          value, sizeof(value)) < 0)
+        return;
+
+    if (rx == NULL) {
+        memset(&stats, 0, sizeof(stats));
+    } else {
+        pthread_mutex_lock(&rx->lock);
+        stats = rx->stats;
+        pthread_mutex_unlock(&rx->lock);
+    }
+
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_FRAMES, stats.frames);
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_UNDERRUNS, stats.underruns);
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_OVERRUNS, stats.overruns);
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_SHORT, stats.short_writes);
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_TARGET, stats.target);
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_JITTER,
+                      (int)(stats.jitter_ns / 1000));
+    str_parms_add_int(reply, AUDIO_PARAMETER_KEY_VOIP_RX_MAX_GAP,
+                      (int)(stats.max_interval_ns / 1000));
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_HW_EXTN_VOIP_RX_H
+#define AUDIO_HW_EXTN_VOIP_RX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct stream_out;
+struct str_parms;
+
+int audio_extn_voip_rx_start(struct stream_out *out);
+void audio_extn_voip_rx_release(struct stream_out *out);
+/*
+ * *written is set to the bytes that reached the pcm device during this call.
+ * Frames held back are counted once they are written, dropped ones never.
+ */
+int audio_extn_voip_rx_write(struct stream_out *out, const void *buffer, size_t bytes,
+                             size_t *written);
+/* Playback time of the frames held back, on top of the pcm buffer */
+uint32_t audio_extn_voip_rx_get_latency_ms(struct stream_out *out);
+void audio_extn_voip_rx_get_parameters(struct stream_out *out,
+                                       struct str_parms *query,
+                                       struct str_parms *reply);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUDIO_HW_EXTN_VOIP_RX_H */
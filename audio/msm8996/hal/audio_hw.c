@@ -46,6 +46,7 @@
 #endif
 
 #include <errno.h>
+#include <inttypes.h>
 #include <pthread.h>
 #include <stdint.h>
 #include <sys/time.h>
@@ -54,6 +55,7 @@
 #include <dlfcn.h>
 #include <sys/resource.h>
 #include <sys/prctl.h>
+#include <sys/system_properties.h>
 
 #include <log/log.h>
 #include <cutils/trace.h>
@@ -985,29 +987,62 @@ int pcm_ioctl(struct pcm *pcm, int request, ...)
 }
 
 
+static bool cached_property_get_bool(struct cached_bool_property *prop)
+{
+    uint32_t serial;
+
+    if (prop->pi == NULL) {
+        prop->pi = __system_property_find(prop->name);
+        if (prop->pi == NULL)
+            return prop->default_value;
+        /* force the first read */
+        prop->serial = __system_property_serial(prop->pi) - 1;
+    }
+
+    serial = __system_property_serial(prop->pi);
+    if (serial != prop->serial) {
+        prop->serial = serial;
+        prop->value = property_get_bool(prop->name, prop->default_value);
+    }
+    return prop->value;
+}
+
+static void set_ess_status(struct audio_device *adev, bool status)
+{
+    if (adev->ess_status == (int)status)
+        return;
+
+    property_set("persist.vendor.audio.ess.status", status ? "true" : "false");
+    adev->ess_status = status;
+}
+
 static void check_and_enable_ess_hifi(struct audio_device *adev, struct audio_usecase *usecase, snd_device_t snd_device)
 {
-    if (property_get_bool("persist.vendor.audio.ess.supported",false) == true) {
+    if (cached_property_get_bool(&adev->ess_supported) && dac_hifi_supported(&adev->dac)) {
         if (snd_device == SND_DEVICE_OUT_HEADPHONES) {
-            if (property_get_bool("persist.vendor.audio.hifi.enabled",false) == true) {
+            if (dac_hifi_wanted(&adev->dac)) {
                 ALOGD("%s: ESS hifi requested...", __func__);
-                disable_audio_route(adev, usecase);
-                disable_snd_device(adev, usecase->out_snd_device);
-                usecase->out_snd_device = SND_DEVICE_OUT_HEADPHONES_HIFI_DAC;
-                audio_route_apply_and_update_path(adev->audio_route, "ess-headphones-hifi");
-                platform_set_snd_device_backend(usecase->out_snd_device, "headphones tert-mi2s-headphones", "SEC_MI2S_RX");
-                ALOGD("%s: Setting ESS hifi mode \n", __func__);
-                property_set("persist.vendor.audio.ess.status","true");
+                if (adev->dac.backend->routes_audio) {
+                    disable_audio_route(adev, usecase);
+                    disable_snd_device(adev, usecase->out_snd_device);
+                    usecase->out_snd_device = SND_DEVICE_OUT_HEADPHONES_HIFI_DAC;
+                    audio_route_apply_and_update_path(adev->audio_route, "ess-headphones-hifi");
+                    platform_set_snd_device_backend(usecase->out_snd_device, "headphones tert-mi2s-headphones", "SEC_MI2S_RX");
+                    ALOGD("%s: Setting ESS hifi mode \n", __func__);
+                } else {
+                    ALOGI("%s: simulated DAC, keeping the headphone route \n", __func__);
+                }
+                set_ess_status(adev, true);
             }
             enable_snd_device(adev, usecase->out_snd_device);
         }
         else {
-            ALOGD("%s: Not an ESS hifi scenario \n", __func__);
-            property_set("persist.vendor.audio.ess.status","false");
+            ALOGV("%s: Not an ESS hifi scenario \n", __func__);
+            set_ess_status(adev, false);
         }
     }
     else {
-        ALOGE("%s: ESS hifi not supported on this device! \n", __func__);
+        ALOGV("%s: ESS hifi not supported on this device! \n", __func__);
     }
 }
 
@@ -4436,6 +4471,33 @@ static char* out_get_parameters(const struct audio_stream *stream, const char *k
         str = str_parms_to_str(reply);
     }
 
+    if (str_parms_get_str(query, "format_convert_stats", value, sizeof(value)) >= 0) {
+        uint64_t periods, bytes, copied;
+
+        lock_output_stream(out);
+        periods = out->convert_periods;
+        bytes = out->convert_bytes;
+        copied = out->convert_copied_bytes;
+        pthread_mutex_unlock(&out->lock);
+
+        snprintf(value, sizeof(value), "%" PRIu64, periods);
+        str_parms_add_str(reply, "format_convert_periods", value);
+        snprintf(value, sizeof(value), "%" PRIu64, bytes);
+        str_parms_add_str(reply, "format_convert_bytes", value);
+        snprintf(value, sizeof(value), "%" PRIu64, copied);
+        str_parms_add_str(reply, "format_convert_copied_bytes", value);
+        if (str)
+            free(str);
+        str = str_parms_to_str(reply);
+    }
+
+    if (out->flags & AUDIO_OUTPUT_FLAG_VOIP_RX) {
+        audio_extn_voip_rx_get_parameters(out, query, reply);
+        if (str)
+            free(str);
+        str = str_parms_to_str(reply);
+    }
+
     if (str_parms_get_str(query, "supports_hw_suspend", value, sizeof(value)) >= 0) {
         //only low latency track supports suspend_resume
         str_parms_add_int(reply, "supports_hw_suspend",
@@ -4480,6 +4542,9 @@ static uint32_t out_get_latency(const struct audio_stream_out *stream)
     if (AUDIO_DEVICE_OUT_ALL_A2DP & out->devices)
         latency += audio_extn_a2dp_get_encoder_latency();
 
+    if (out->flags & AUDIO_OUTPUT_FLAG_VOIP_RX)
+        latency += audio_extn_voip_rx_get_latency_ms(out);
+
     ALOGV("%s: Latency %d", __func__, latency);
     return latency;
 }
@@ -4662,6 +4727,44 @@ static void update_frames_written(struct stream_out *out, size_t bytes)
     pthread_mutex_unlock(&out->position_query_lock);
 }
 
+/*
+ * Converts a buffer from the format audio flinger writes (hal_ip_format) to the
+ * one the driver runs at (hal_op_format). All conversions the HAL sets up keep or
+ * shrink the sample size, so they run in place in the caller's buffer and the
+ * driver is handed that buffer. convert_buffer is only used when the output
+ * sample is larger, in which case at most convert_buffer_size bytes are produced.
+ *
+ * Returns the buffer to pass on and sets *out_bytes to its length.
+ */
+static void *out_convert_format(struct stream_out *out, const void *buffer,
+                                size_t bytes, size_t *out_bytes)
+{
+    size_t ip_size = audio_bytes_per_sample(out->hal_ip_format);
+    size_t op_size = audio_bytes_per_sample(out->hal_op_format);
+    size_t samples;
+    void *dst = (void *)buffer;
+
+    if (ip_size == 0 || op_size == 0) {
+        *out_bytes = bytes;
+        return dst;
+    }
+
+    samples = bytes / ip_size;
+    if (op_size > ip_size) {
+        if (samples > out->convert_buffer_size / op_size)
+            samples = out->convert_buffer_size / op_size;
+        dst = out->convert_buffer;
+        out->convert_copied_bytes += samples * op_size;
+    }
+
+    memcpy_by_audio_format(dst, out->hal_op_format, buffer, out->hal_ip_format, samples);
+
+    *out_bytes = samples * op_size;
+    out->convert_periods++;
+    out->convert_bytes += *out_bytes;
+    return dst;
+}
+
 static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
                          size_t bytes)
 {
@@ -4671,6 +4774,8 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
     int channels = 0;
     const size_t frame_size = audio_stream_out_frame_size(stream);
     const size_t frames = (frame_size != 0) ? bytes / frame_size : bytes;
+    /* Bytes that count towards the presentation position */
+    size_t bytes_written = bytes;
     struct audio_usecase *usecase = NULL;
 
     ATRACE_BEGIN("out_write");
@@ -4777,6 +4882,9 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
             goto exit;
         }
         out->started = 1;
+        if ((out->flags & AUDIO_OUTPUT_FLAG_VOIP_RX) &&
+            audio_extn_voip_rx_start(out) != 0)
+            ALOGW("%s: no VOIP frame pool, writing through", __func__);
         if (last_known_cal_step != -1) {
             ALOGD("%s: retry previous failed cal level set", __func__);
             audio_hw_send_gain_dep_calibration(last_known_cal_step);
@@ -4826,7 +4934,9 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
             }
         }
         if (!(out->flags & AUDIO_OUTPUT_FLAG_COMPRESS_OFFLOAD) &&
-                      (out->convert_buffer) != NULL) {
+                      out->hal_ip_format != out->hal_op_format &&
+                      audio_bytes_per_sample(out->hal_ip_format) !=
+                      audio_bytes_per_sample(out->hal_op_format)) {
 
             if ((bytes > out->hal_fragment_size)) {
                 ALOGW("Error written bytes %zu > %d (fragment_size)",
@@ -4836,19 +4946,10 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
                 return -EINVAL;
             } else {
                 audio_format_t dst_format = out->hal_op_format;
-                audio_format_t src_format = out->hal_ip_format;
-
-                uint32_t frames = bytes / format_to_bitwidth_table[src_format];
-                uint32_t bytes_to_write = frames * format_to_bitwidth_table[dst_format];
+                size_t bytes_to_write;
+                void *data = out_convert_format(out, buffer, bytes, &bytes_to_write);
 
-                memcpy_by_audio_format(out->convert_buffer,
-                                       dst_format,
-                                       buffer,
-                                       src_format,
-                                       frames);
-
-                ret = compress_write(out->compr, out->convert_buffer,
-                                     bytes_to_write);
+                ret = compress_write(out->compr, data, bytes_to_write);
 
                 /*Convert written bytes in audio flinger format*/
                 if (ret > 0)
@@ -4907,8 +5008,6 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
             if (out->usecase == USECASE_INCALL_MUSIC_UPLINK ||
                         out->usecase == USECASE_INCALL_MUSIC_UPLINK2) {
                 size_t channel_count = audio_channel_count_from_out_mask(out->channel_mask);
-                int16_t *src = (int16_t *)buffer;
-                int16_t *dst = (int16_t *)buffer;
 
                 LOG_ALWAYS_FATAL_IF(out->config.channels != 1 || channel_count != 2 ||
                                     out->format != AUDIO_FORMAT_PCM_16_BIT,
@@ -4919,13 +5018,8 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
                  * mono output
                  */
 
-                /*
-                 * Code below goes over each frame in the buffer and adds both
-                 * L and R samples and then divides by 2 to convert to mono
-                 */
-                for (size_t i = 0; i < frames ; i++, dst++, src += 2) {
-                    *dst = (int16_t)(((int32_t)src[0] + (int32_t)src[1]) >> 1);
-                }
+                audio_extn_downmix_stereo_to_mono_16((int16_t *)buffer,
+                                                     (const int16_t *)buffer, frames);
                 bytes_to_write /= 2;
             }
 
@@ -4942,40 +5036,21 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
 
             if (use_mmap)
                 ret = pcm_mmap_write(out->pcm, (void *)buffer, bytes_to_write);
-            else if (out->hal_op_format != out->hal_ip_format &&
-                       out->convert_buffer != NULL) {
-
-                memcpy_by_audio_format(out->convert_buffer,
-                                       out->hal_op_format,
-                                       buffer,
-                                       out->hal_ip_format,
-                                       out->config.period_size * out->config.channels);
-
-                ret = pcm_write(out->pcm, out->convert_buffer,
-                                 (out->config.period_size *
-                                 out->config.channels *
-                                 format_to_bitwidth_table[out->hal_op_format]));
-            } else {
+            else if (out->hal_op_format != out->hal_ip_format) {
+                void *data = out_convert_format(out, buffer, bytes_to_write,
+                                                &bytes_to_write);
+
+                ret = pcm_write(out->pcm, data, bytes_to_write);
+            } else if (out->flags & AUDIO_OUTPUT_FLAG_VOIP_RX) {
                 /*
-                 * To avoid underrun in DSP when the application is not pumping
-                 * data at required rate, check for the no. of bytes and ignore
-                 * pcm_write if it is less than actual buffer size.
-                 * It is a work around to a change in compress VOIP driver.
+                 * The compress VOIP driver underruns the DSP on short writes,
+                 * so VOIP frames are assembled and paced by the jitter buffer.
+                 * Frames it holds back are only counted once they reach the DSP.
                  */
-                if ((out->flags & AUDIO_OUTPUT_FLAG_VOIP_RX) &&
-                    bytes < (out->config.period_size * out->config.channels *
-                    audio_bytes_per_sample(out->format))) {
-                    size_t voip_buf_size =
-                        out->config.period_size * out->config.channels *
-                        audio_bytes_per_sample(out->format);
-                    ALOGE("%s:VOIP underrun: bytes received %zu, required:%zu\n",
-                            __func__, bytes, voip_buf_size);
-                    usleep(((uint64_t)voip_buf_size - bytes) *
-                           1000000 / audio_stream_out_frame_size(stream) /
-                           out_get_sample_rate(&out->stream.common));
-                    ret = 0;
-                } else
-                    ret = pcm_write(out->pcm, (void *)buffer, bytes_to_write);
+                ret = audio_extn_voip_rx_write(out, buffer, bytes_to_write,
+                                               &bytes_written);
+            } else {
+                ret = pcm_write(out->pcm, (void *)buffer, bytes_to_write);
             }
 
             release_out_focus(out);
@@ -4988,7 +5063,7 @@ static ssize_t out_write(struct audio_stream_out *stream, const void *buffer,
     }
 
 exit:
-    update_frames_written(out, bytes);
+    update_frames_written(out, bytes_written);
     if (-ENETRESET == ret) {
         out->card_status = CARD_STATUS_OFFLINE;
     }
@@ -6457,10 +6532,11 @@ int adev_open_output_stream(struct audio_hw_device *dev,
             /*if hal input and output fragment size is different this indicates HAL input format is
              *not same as the alsa format
              */
-            if (out->hal_fragment_size != out->compr_config.fragment_size) {
+            if (out->hal_fragment_size < out->compr_config.fragment_size) {
                 /*Allocate a buffer to convert input data to the alsa configured format.
                  *size of convert buffer is equal to the size required to hold one fragment size
-                 *worth of pcm data, this is because flinger does not write more than fragment_size
+                 *worth of pcm data, this is because flinger does not write more than fragment_size.
+                 *Conversions to a smaller format are done in place and need no buffer.
                  */
                 out->convert_buffer = calloc(1,out->compr_config.fragment_size);
                 if (out->convert_buffer == NULL){
@@ -6468,6 +6544,7 @@ int adev_open_output_stream(struct audio_hw_device *dev,
                     ret = -ENOMEM;
                     goto error_open;
                 }
+                out->convert_buffer_size = out->compr_config.fragment_size;
             }
         } else if (audio_extn_passthru_is_passthrough_stream(out)) {
             out->compr_config.fragment_size =
@@ -6691,7 +6768,9 @@ int adev_open_output_stream(struct audio_hw_device *dev,
         out->config.rate = config->sample_rate;
         out->sample_rate = out->config.rate;
         out->config.channels = channels;
-        if (out->hal_ip_format != out->hal_op_format) {
+        /* Conversions to a smaller or equal sample size are done in place */
+        if (audio_bytes_per_sample(out->hal_op_format) >
+                audio_bytes_per_sample(out->hal_ip_format)) {
             uint32_t buffer_size = out->config.period_size *
                                    format_to_bitwidth_table[out->hal_op_format] *
                                    out->config.channels;
@@ -6702,6 +6781,7 @@ int adev_open_output_stream(struct audio_hw_device *dev,
                 ret = -ENOMEM;
                 goto error_open;
             }
+            out->convert_buffer_size = buffer_size;
             ALOGD("Convert buffer allocated of size %d", buffer_size);
         }
     }
@@ -6885,6 +6965,8 @@ void adev_close_output_stream(struct audio_hw_device *dev __unused,
         out->convert_buffer = NULL;
     }
 
+    audio_extn_voip_rx_release(out);
+
     if (adev->voice_tx_output == out)
         adev->voice_tx_output = NULL;
 
@@ -8034,6 +8116,9 @@ static int adev_open(const hw_module_t *module, const char *name,
     adev->acdb_settings = TTY_MODE_OFF;
     adev->allow_afe_proxy_usage = true;
     adev->bt_sco_on = false;
+    adev->ess_supported.name = "persist.vendor.audio.ess.supported";
+    dac_init(&adev->dac);
+    adev->ess_status = -1;
     /* adev->cur_hdmi_channels = 0;  by calloc() */
     adev->snd_dev_ref_cnt = calloc(SND_DEVICE_MAX, sizeof(int));
     voice_init(adev);
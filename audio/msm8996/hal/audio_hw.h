@@ -46,6 +46,7 @@
 #include <tinycompress/tinycompress.h>
 
 #include <audio_route/audio_route.h>
+#include <dac_backend.h>
 #include "audio_defs.h"
 #include "voice.h"
 #include "audio_hw_extn_api.h"
@@ -328,6 +329,12 @@ struct stream_out {
     audio_format_t hal_ip_format;
     audio_format_t hal_op_format;
     void *convert_buffer;
+    size_t convert_buffer_size;
+    /* Periods converted, bytes handed to the driver and bytes staged in convert_buffer */
+    uint64_t convert_periods;
+    uint64_t convert_bytes;
+    uint64_t convert_copied_bytes;
+    struct voip_rx *voip_rx;
 
     bool realtime;
     int af_period_multiplier;
@@ -467,6 +474,15 @@ typedef void (*adm_request_focus_v2_t)(void *, audio_io_handle_t, long);
 typedef bool (*adm_is_noirq_avail_t)(void *, int, int, int);
 typedef void (*adm_on_routing_change_t)(void *, audio_io_handle_t);
 
+/* Boolean system property that is only re-read when its serial changes */
+struct cached_bool_property {
+    const char *name;
+    bool default_value;
+    const struct prop_info *pi;
+    uint32_t serial;
+    bool value;
+};
+
 struct audio_device {
     struct audio_hw_device device;
     pthread_mutex_t lock; /* see note below on mutex acquisition order */
@@ -548,6 +564,9 @@ struct audio_device {
     void *ext_hw_plugin;
     bool use_old_pspd_mix_ctrl;
     amplifier_device_t *amp;
+    struct cached_bool_property ess_supported;
+    dac_state_t dac; /* Hi-Fi DAC backend and state, shared with the amplifier and DacControl */
+    int ess_status; /* last value written to persist.vendor.audio.ess.status, -1 if none */
 };
 
 int select_devices(struct audio_device *adev,
@@ -7900,7 +7900,7 @@ done:
 int platform_set_sidetone(struct audio_device *adev,
                           snd_device_t out_snd_device,
                           bool enable,
-                          char *str)
+                          const char *str)
 {
     int ret;
     if ((out_snd_device == SND_DEVICE_OUT_USB_HEADSET) ||
@@ -7946,7 +7946,7 @@ int platform_set_sidetone(struct audio_device *adev,
 void platform_update_aanc_path(struct audio_device *adev,
                                snd_device_t out_snd_device,
                                bool enable,
-                               char *str)
+                               const char *str)
 {
     ALOGD("%s: aanc out device(%d) mixer cmd = %s, enable = %d\n",
           __func__, out_snd_device, str, enable);
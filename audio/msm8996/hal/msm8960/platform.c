@@ -1330,7 +1330,7 @@ int platform_retrieve_audio_cal(void* platform __unused,
 int platform_set_sidetone(struct audio_device *adev,
                           snd_device_t out_snd_device,
                           bool enable,
-                          char *str)
+                          const char *str)
 {
     int ret;
     if (out_snd_device == SND_DEVICE_OUT_USB_HEADSET) {
@@ -1353,7 +1353,7 @@ int platform_set_sidetone(struct audio_device *adev,
 void platform_update_aanc_path(struct audio_device *adev __unused,
                                snd_device_t out_snd_device __unused,
                                bool enable __unused,
-                               char *str __unused)
+                               const char *str __unused)
 {
     return;
 }
@@ -264,11 +264,11 @@ bool platform_check_backends_match(snd_device_t snd_device1, snd_device_t snd_de
 int platform_set_sidetone(struct audio_device *adev,
                           snd_device_t out_snd_device,
                           bool enable,
-                          char * str);
+                          const char *str);
 void platform_update_aanc_path(struct audio_device *adev,
                               snd_device_t out_snd_device,
                               bool enable,
-                              char * str);
+                              const char *str);
 bool platform_supports_true_32bit();
 bool platform_check_if_backend_has_to_be_disabled(snd_device_t new_snd_device, snd_device_t cuurent_snd_device);
 bool platform_check_codec_dsd_support(void *platform);
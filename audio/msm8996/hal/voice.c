@@ -48,87 +48,116 @@ struct pcm_config pcm_config_voice_call = {
     .format = PCM_FORMAT_S16_LE,
 };
 
-static struct voice_session *voice_get_session_from_use_case(struct audio_device *adev,
-                              audio_usecase_t usecase_id)
+/*
+ * Session index of each voice usecase, -1 for usecases that do not carry a call.
+ * Filled in by voice_init() so that the per-call paths do not go through the
+ * extension for every lookup.
+ */
+static int voice_session_idx[AUDIO_USECASE_MAX];
+
+/*
+ * Voice specific mixer paths of each output snd device. USB headsets have
+ * sidetone handled by the USB driver, hence no path.
+ */
+static const struct {
+    bool sidetone;
+    const char *sidetone_path;
+    const char *aanc_path;
+} voice_snd_device_class[SND_DEVICE_MAX] = {
+    [SND_DEVICE_OUT_VOICE_HANDSET] = {true, "sidetone-handset", NULL},
+    [SND_DEVICE_OUT_VOICE_HEADPHONES] = {true, "sidetone-headphones", NULL},
+    [SND_DEVICE_OUT_VOICE_ANC_HEADSET] = {true, "sidetone-headphones", NULL},
+    [SND_DEVICE_OUT_VOICE_ANC_FB_HEADSET] = {true, "sidetone-headphones", NULL},
+    [SND_DEVICE_OUT_USB_HEADSET] = {true, NULL, NULL},
+    [SND_DEVICE_OUT_ANC_HANDSET] = {false, NULL, "aanc-path"},
+};
+
+static void voice_init_session_index(struct audio_device *adev)
 {
+    static const audio_usecase_t voice_usecases[] = {
+        USECASE_VOICE_CALL,
+        USECASE_VOICE2_CALL,
+        USECASE_VOLTE_CALL,
+        USECASE_QCHAT_CALL,
+        USECASE_VOWLAN_CALL,
+        USECASE_VOICEMMODE1_CALL,
+        USECASE_VOICEMMODE2_CALL,
+    };
     struct voice_session *session = NULL;
-    int ret = 0;
+    size_t i;
 
-    ret = voice_extn_get_session_from_use_case(adev, usecase_id, &session);
-    if (ret == -ENOSYS) {
-        session = &adev->voice.session[VOICE_SESS_IDX];
+    if (voice_extn_get_session_from_use_case(adev, USECASE_VOICE_CALL,
+                                             &session) == -ENOSYS) {
+        /* Without the extension every usecase maps to the only session */
+        for (i = 0; i < AUDIO_USECASE_MAX; i++)
+            voice_session_idx[i] = VOICE_SESS_IDX;
+        return;
     }
 
-    return session;
+    for (i = 0; i < AUDIO_USECASE_MAX; i++)
+        voice_session_idx[i] = -1;
+
+    for (i = 0; i < ARRAY_SIZE(voice_usecases); i++) {
+        if (voice_extn_get_session_from_use_case(adev, voice_usecases[i],
+                                                 &session) == 0 && session)
+            voice_session_idx[voice_usecases[i]] = session - adev->voice.session;
+    }
 }
 
-static bool voice_is_sidetone_device(snd_device_t out_device,
-            char *mixer_path)
+static struct voice_session *voice_get_session_from_use_case(struct audio_device *adev,
+                              audio_usecase_t usecase_id)
 {
-    bool is_sidetone_dev;
-
-    switch (out_device) {
-    case SND_DEVICE_OUT_VOICE_HANDSET:
-        is_sidetone_dev = true;
-        strlcpy(mixer_path, "sidetone-handset", MIXER_PATH_MAX_LENGTH);
-        break;
-    case SND_DEVICE_OUT_VOICE_HEADPHONES:
-    case SND_DEVICE_OUT_VOICE_ANC_HEADSET:
-    case SND_DEVICE_OUT_VOICE_ANC_FB_HEADSET:
-        is_sidetone_dev = true;
-        strlcpy(mixer_path, "sidetone-headphones", MIXER_PATH_MAX_LENGTH);
-        break;
-    case SND_DEVICE_OUT_USB_HEADSET:
-        is_sidetone_dev = true;
-        break;
-    default:
-        is_sidetone_dev = false;
-        break;
+    if (usecase_id < 0 || usecase_id >= AUDIO_USECASE_MAX ||
+        voice_session_idx[usecase_id] < 0) {
+        ALOGE("%s: Invalid usecase_id:%d\n", __func__, usecase_id);
+        return NULL;
     }
 
-    return is_sidetone_dev;
+    return &adev->voice.session[voice_session_idx[usecase_id]];
+}
+
+static bool voice_is_sidetone_device(snd_device_t out_device,
+            const char **mixer_path)
+{
+    if (out_device <= SND_DEVICE_NONE || out_device >= SND_DEVICE_MAX)
+        return false;
+
+    *mixer_path = voice_snd_device_class[out_device].sidetone_path;
+    return voice_snd_device_class[out_device].sidetone;
 }
 
 void voice_set_sidetone(struct audio_device *adev,
         snd_device_t out_snd_device, bool enable)
 {
-    char mixer_path[MIXER_PATH_MAX_LENGTH];
+    const char *mixer_path;
     ALOGD("%s: %s, out_snd_device: %d\n",
           __func__, (enable ? "enable" : "disable"),
           out_snd_device);
-    if (voice_is_sidetone_device(out_snd_device, mixer_path))
+    if (voice_is_sidetone_device(out_snd_device, &mixer_path))
         platform_set_sidetone(adev, out_snd_device, enable, mixer_path);
     return;
 }
 
 static bool voice_is_aanc_device(snd_device_t out_device,
-                                 char *mixer_path)
+                                 const char **mixer_path)
 {
-    bool is_aanc_dev;
-
-    switch (out_device) {
-        case SND_DEVICE_OUT_ANC_HANDSET:
-            is_aanc_dev = true;
-            strlcpy(mixer_path, "aanc-path", MIXER_PATH_MAX_LENGTH);
-            break;
-        default:
-            is_aanc_dev = false;
-            break;
-    }
+    if (out_device <= SND_DEVICE_NONE || out_device >= SND_DEVICE_MAX)
+        return false;
 
-    return is_aanc_dev;
+    *mixer_path = voice_snd_device_class[out_device].aanc_path;
+    return *mixer_path != NULL;
 }
 
 void voice_check_and_update_aanc_path(struct audio_device *adev,
                                       snd_device_t out_snd_device,
                                       bool enable)
 {
-    char mixer_path[MIXER_PATH_MAX_LENGTH];
+    const char *mixer_path;
 
     ALOGV("%s: %s, out_snd_device: %d\n",
           __func__, (enable ? "enable" : "disable"), out_snd_device);
 
-    if (voice_is_aanc_device(out_snd_device, mixer_path))
+    if (voice_is_aanc_device(out_snd_device, &mixer_path))
         platform_update_aanc_path(adev, out_snd_device, enable, mixer_path);
 
     return;
@@ -710,16 +739,22 @@ void voice_init(struct audio_device *adev)
     }
 
     voice_extn_init(adev);
+    voice_init_session_index(adev);
 }
 
 void voice_update_devices_for_all_voice_usecases(struct audio_device *adev)
 {
     struct listnode *node;
     struct audio_usecase *usecase;
+    struct voice_session *session;
 
     list_for_each(node, &adev->usecase_list) {
         usecase = node_to_item(node, struct audio_usecase, list);
         if (usecase->type == VOICE_CALL) {
+            session = voice_get_session_from_use_case(adev, usecase->id);
+            /* Sessions that are not in a call have nothing routed yet */
+            if (!session || session->state.current == CALL_INACTIVE)
+                continue;
             ALOGV("%s: updating device for usecase:%s", __func__,
                   use_case_table[usecase->id]);
             usecase->stream.out = adev->current_call_output;
@@ -18,13 +18,17 @@
 
 #include <hardware/hw_auth_token.h>
 
-#include <android-base/file.h>
 #include <android-base/strings.h>
 #include <hardware/hardware.h>
 #include "fingerprint.h"
 #include "BiometricsFingerprint.h"
 
+#include <utils/Timers.h>
+
+#include <algorithm>
 #include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <unistd.h>
 
 namespace android {
@@ -43,18 +47,35 @@ BiometricsFingerprint *BiometricsFingerprint::sInstance = nullptr;
 
 BiometricsFingerprint::BiometricsFingerprint() : mClientCallback(nullptr), mDevice(nullptr) {
     sInstance = this; // keep track of the most recent instance
+    mDispatchThread = std::thread(&BiometricsFingerprint::dispatchLoop, this);
     mDevice = openHal();
     if (!mDevice) {
         ALOGE("Can't open HAL module");
     }
+#ifdef LGE_EGISTEC_UDFPS
+    else {
+        mFod = std::make_unique<FodController>(mDevice);
+    }
+#endif // LGE_EGISTEC_UDFPS
 }
 
 BiometricsFingerprint::~BiometricsFingerprint() {
     ALOGV("~BiometricsFingerprint()");
+    {
+        std::lock_guard<std::mutex> lock(mEventMutex);
+        mQuit = true;
+    }
+    mEventCond.notify_one();
+    mDispatchThread.join();
+
     if (mDevice == nullptr) {
         ALOGE("No valid device");
         return;
     }
+#ifdef LGE_EGISTEC_UDFPS
+    // Turns LHBM off and stops the scan while the device is still open
+    mFod.reset();
+#endif // LGE_EGISTEC_UDFPS
     int err;
     if (0 != (err = mDevice->common.close(
             reinterpret_cast<hw_device_t*>(mDevice)))) {
@@ -196,9 +217,7 @@ Return<RequestStatus> BiometricsFingerprint::cancel() {
         return RequestStatus::SYS_UNKNOWN;
     }
 #ifdef LGE_EGISTEC_UDFPS
-    if (hbmFodEnabled) {
-        BiometricsFingerprint::onFingerUp();
-    }
+    mFod->setFingerDown(false);
 #endif // LGE_EGISTEC_UDFPS
     return ErrorFilter(mDevice->cancel(mDevice));
 }
@@ -308,18 +327,84 @@ fingerprint_device_t* BiometricsFingerprint::openHal() {
 void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
     BiometricsFingerprint* thisPtr = static_cast<BiometricsFingerprint*>(
             BiometricsFingerprint::getInstance());
-    std::lock_guard<std::mutex> lock(thisPtr->mClientCallbackMutex);
-    if (thisPtr == nullptr || thisPtr->mClientCallback == nullptr) {
+    if (thisPtr == nullptr) {
+        return;
+    }
+
+    // Called on the vendor library's thread: queue the message and return, the
+    // framework callbacks are made from the dispatch thread.
+    thisPtr->queueEvent(msg);
+
+#ifdef LGE_EGISTEC_UDFPS
+    if (thisPtr->mFod != nullptr) {
+        thisPtr->mFod->setFingerDown(false);
+    }
+#endif // LGE_EGISTEC_UDFPS
+}
+
+void BiometricsFingerprint::queueEvent(const fingerprint_msg_t *msg) {
+    {
+        std::lock_guard<std::mutex> lock(mEventMutex);
+        if (mEventCount == mEvents.size()) {
+            mEventsDropped++;
+            ALOGE("Event queue full, dropping message of type %d", msg->type);
+            return;
+        }
+
+        Event& event = mEvents[(mEventHead + mEventCount) % mEvents.size()];
+        event.msg = *msg;
+        event.queuedNs = systemTime(SYSTEM_TIME_MONOTONIC);
+        mEventCount++;
+        mEventsMaxDepth = std::max(mEventsMaxDepth, mEventCount);
+    }
+    mEventCond.notify_one();
+}
+
+void BiometricsFingerprint::dispatchLoop() {
+    pthread_setname_np(pthread_self(), "fp-dispatch");
+
+    std::unique_lock<std::mutex> lock(mEventMutex);
+    for (;;) {
+        mEventCond.wait(lock, [this] { return mEventCount > 0 || mQuit; });
+
+        while (mEventCount > 0) {
+            Event event = mEvents[mEventHead];
+            mEventHead = (mEventHead + 1) % mEvents.size();
+            mEventCount--;
+
+            int64_t latencyNs = systemTime(SYSTEM_TIME_MONOTONIC) - event.queuedNs;
+            mEventsDispatched++;
+            mEventsTotalLatencyNs += latencyNs;
+            mEventsMaxLatencyNs = std::max(mEventsMaxLatencyNs, latencyNs);
+
+            lock.unlock();
+            dispatch(&event.msg);
+            lock.lock();
+        }
+
+        if (mQuit) {
+            return;
+        }
+    }
+}
+
+void BiometricsFingerprint::dispatch(const fingerprint_msg_t *msg) {
+    sp<IBiometricsFingerprintClientCallback> callback;
+    {
+        std::lock_guard<std::mutex> lock(mClientCallbackMutex);
+        callback = mClientCallback;
+    }
+    if (callback == nullptr) {
         ALOGE("Receiving callbacks before the client callback is registered.");
         return;
     }
-    const uint64_t devId = reinterpret_cast<uint64_t>(thisPtr->mDevice);
+    const uint64_t devId = reinterpret_cast<uint64_t>(mDevice);
     switch (msg->type) {
         case FINGERPRINT_ERROR: {
                 int32_t vendorCode = 0;
                 FingerprintError result = VendorErrorFilter(msg->data.error, &vendorCode);
                 ALOGD("onError(%d)", result);
-                if (!thisPtr->mClientCallback->onError(devId, result, vendorCode).isOk()) {
+                if (!callback->onError(devId, result, vendorCode).isOk()) {
                     ALOGE("failed to invoke fingerprint onError callback");
                 }
             }
@@ -329,7 +414,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                 FingerprintAcquiredInfo result =
                     VendorAcquiredFilter(msg->data.acquired.acquired_info, &vendorCode);
                 ALOGD("onAcquired(%d)", result);
-                if (!thisPtr->mClientCallback->onAcquired(devId, result, vendorCode).isOk()) {
+                if (!callback->onAcquired(devId, result, vendorCode).isOk()) {
                     ALOGE("failed to invoke fingerprint onAcquired callback");
                 }
             }
@@ -339,7 +424,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                 msg->data.enroll.finger.fid,
                 msg->data.enroll.finger.gid,
                 msg->data.enroll.samples_remaining);
-            if (!thisPtr->mClientCallback->onEnrollResult(devId,
+            if (!callback->onEnrollResult(devId,
                     msg->data.enroll.finger.fid,
                     msg->data.enroll.finger.gid,
                     msg->data.enroll.samples_remaining).isOk()) {
@@ -351,7 +436,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                 msg->data.removed.finger.fid,
                 msg->data.removed.finger.gid,
                 msg->data.removed.remaining_templates);
-            if (!thisPtr->mClientCallback->onRemoved(devId,
+            if (!callback->onRemoved(devId,
                     msg->data.removed.finger.fid,
                     msg->data.removed.finger.gid,
                     msg->data.removed.remaining_templates).isOk()) {
@@ -367,7 +452,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                     reinterpret_cast<const uint8_t *>(&msg->data.authenticated.hat);
                 const hidl_vec<uint8_t> token(
                     std::vector<uint8_t>(hat, hat + sizeof(msg->data.authenticated.hat)));
-                if (!thisPtr->mClientCallback->onAuthenticated(devId,
+                if (!callback->onAuthenticated(devId,
                         msg->data.authenticated.finger.fid,
                         msg->data.authenticated.finger.gid,
                         token).isOk()) {
@@ -375,7 +460,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                 }
             } else {
                 // Not a recognized fingerprint
-                if (!thisPtr->mClientCallback->onAuthenticated(devId,
+                if (!callback->onAuthenticated(devId,
                         msg->data.authenticated.finger.fid,
                         msg->data.authenticated.finger.gid,
                         hidl_vec<uint8_t>()).isOk()) {
@@ -388,7 +473,7 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
                 msg->data.enumerated.finger.fid,
                 msg->data.enumerated.finger.gid,
                 msg->data.enumerated.remaining_templates);
-            if (!thisPtr->mClientCallback->onEnumerate(devId,
+            if (!callback->onEnumerate(devId,
                     msg->data.enumerated.finger.fid,
                     msg->data.enumerated.finger.gid,
                     msg->data.enumerated.remaining_templates).isOk()) {
@@ -396,47 +481,28 @@ void BiometricsFingerprint::notify(const fingerprint_msg_t *msg) {
             }
             break;
     }
-#ifdef LGE_EGISTEC_UDFPS
-    if (thisPtr->hbmFodEnabled) {
-        thisPtr->onFingerUp();
-    }
-#endif // LGE_EGISTEC_UDFPS
-}
-
-#ifdef LGE_EGISTEC_UDFPS
-#define FOD_HBM_PATH "/sys/devices/virtual/panel/brightness/fp_lhbm"
-
-static void setFodHbm(bool status) {
-    android::base::WriteStringToFile(status ? "1" : "0", FOD_HBM_PATH);
 }
 
-void BiometricsFingerprint::disableHighBrightFod() {
-    std::lock_guard<std::mutex> lock(mSetHbmFodMutex);
-    uint32_t param = 0;
-
-    if (!hbmFodEnabled)
-        return;
-
-    mDevice->do_extra_api_in(FINGERPRINT_LGE_SCAN_STOP, &param);
-
-    setFodHbm(false);
-
-    hbmFodEnabled = false;
-}
-
-void BiometricsFingerprint::enableHighBrightFod() {
-    std::lock_guard<std::mutex> lock(mSetHbmFodMutex);
-    uint32_t param = 0;
-    if (hbmFodEnabled)
-        return;
-
-    mDevice->do_extra_api_in(FINGERPRINT_LGE_SCAN_START, &param);
-
-    setFodHbm(true);
-
-    hbmFodEnabled = true;
+Return<void> BiometricsFingerprint::debug(const hidl_handle& handle,
+        const hidl_vec<hidl_string>&) {
+    if (handle == nullptr || handle->numFds < 1) {
+        return Void();
+    }
+    int fd = handle->data[0];
+
+    std::lock_guard<std::mutex> lock(mEventMutex);
+    dprintf(fd, "Callback dispatch:\n");
+    dprintf(fd, "  dispatched: %" PRIu64 "\n", mEventsDispatched);
+    dprintf(fd, "  dropped (queue full): %" PRIu64 "\n", mEventsDropped);
+    dprintf(fd, "  queued now: %zu, max: %zu of %zu\n", mEventCount, mEventsMaxDepth,
+            mEvents.size());
+    if (mEventsDispatched > 0) {
+        dprintf(fd, "  latency avg: %" PRId64 "us, max: %" PRId64 "us\n",
+                mEventsTotalLatencyNs / (int64_t)mEventsDispatched / 1000,
+                mEventsMaxLatencyNs / 1000);
+    }
+    return Void();
 }
-#endif // LGE_EGISTEC_UDFPS
 
 // ::V2_3::IBiometricsFingerprint follow.
 
@@ -450,7 +516,9 @@ Return<bool> BiometricsFingerprint::isUdfps(uint32_t) {
 
 Return<void> BiometricsFingerprint::onFingerDown(uint32_t, uint32_t, float, float) {
 #ifdef LGE_EGISTEC_UDFPS
-    BiometricsFingerprint::enableHighBrightFod();
+    if (mFod != nullptr) {
+        mFod->setFingerDown(true);
+    }
 #endif // LGE_EGISTEC_UDFPS
 
     return Void();
@@ -458,7 +526,9 @@ Return<void> BiometricsFingerprint::onFingerDown(uint32_t, uint32_t, float, floa
 
 Return<void> BiometricsFingerprint::onFingerUp() {
 #ifdef LGE_EGISTEC_UDFPS
-    BiometricsFingerprint::disableHighBrightFod();
+    if (mFod != nullptr) {
+        mFod->setFingerDown(false);
+    }
 #endif // LGE_EGISTEC_UDFPS
 
     return Void();
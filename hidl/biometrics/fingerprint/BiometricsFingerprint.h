@@ -21,10 +21,17 @@
 #include <android/log.h>
 #include <hardware/hardware.h>
 #include "fingerprint.h"
+#include "FodController.h"
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 #include <android/hardware/biometrics/fingerprint/2.3/IBiometricsFingerprint.h>
 
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 namespace android {
 namespace hardware {
 namespace biometrics {
@@ -42,6 +49,7 @@ using FingerprintAcquiredInfo =
 using FingerprintError =
         ::android::hardware::biometrics::fingerprint::V2_1::FingerprintError;
 
+using ::android::hardware::hidl_handle;
 using ::android::hardware::Return;
 using ::android::hardware::Void;
 using ::android::hardware::hidl_vec;
@@ -73,6 +81,8 @@ public:
     Return<void> onFingerDown(uint32_t x, uint32_t y, float minor, float major) override;
     Return<void> onFingerUp() override;
 
+    Return<void> debug(const hidl_handle& handle, const hidl_vec<hidl_string>& args) override;
+
 private:
     static fingerprint_device_t* openHal();
     static void notify(const fingerprint_msg_t *msg); /* Static callback for legacy HAL implementation */
@@ -81,16 +91,36 @@ private:
     static FingerprintAcquiredInfo VendorAcquiredFilter(int32_t error, int32_t* vendorCode);
     static BiometricsFingerprint* sInstance;
 
+    struct Event {
+        fingerprint_msg_t msg;
+        int64_t queuedNs;
+    };
+
+    void queueEvent(const fingerprint_msg_t *msg);
+    void dispatchLoop();
+    void dispatch(const fingerprint_msg_t *msg);
+
 #ifdef LGE_EGISTEC_UDFPS
-    void disableHighBrightFod();
-    void enableHighBrightFod();
-    bool hbmFodEnabled;
-    std::mutex mSetHbmFodMutex;
+    std::unique_ptr<FodController> mFod;
 #endif
 
     std::mutex mClientCallbackMutex;
     sp<IBiometricsFingerprintClientCallback> mClientCallback;
     fingerprint_device_t *mDevice;
+
+    // Messages from the vendor library waiting to be sent to the client
+    std::mutex mEventMutex;
+    std::condition_variable mEventCond;
+    std::array<Event, 64> mEvents;
+    size_t mEventHead = 0;
+    size_t mEventCount = 0;
+    bool mQuit = false;
+    uint64_t mEventsDispatched = 0;
+    uint64_t mEventsDropped = 0;
+    size_t mEventsMaxDepth = 0;
+    int64_t mEventsTotalLatencyNs = 0;
+    int64_t mEventsMaxLatencyNs = 0;
+    std::thread mDispatchThread;
 };
 
 }  // namespace implementation
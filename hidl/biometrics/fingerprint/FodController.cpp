@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "android.hardware.biometrics.fingerprint@2.3-service.lge"
+
+#include "FodController.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <log/log.h>
+#include <system/thread_defs.h>
+#include <utils/Timers.h>
+
+namespace android {
+namespace hardware {
+namespace biometrics {
+namespace fingerprint {
+namespace V2_3 {
+namespace implementation {
+
+#define FOD_HBM_PATH "/sys/devices/virtual/panel/brightness/fp_lhbm"
+
+FodController::FodController(fingerprint_device_t* device) : mDevice(device) {
+    mHbmFd = open(FOD_HBM_PATH, O_WRONLY | O_CLOEXEC);
+    if (mHbmFd < 0) {
+        ALOGE("Can't open %s: %s", FOD_HBM_PATH, strerror(errno));
+    }
+
+    mThread = std::thread(&FodController::threadLoop, this);
+}
+
+FodController::~FodController() {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mWanted = false;
+        mRequestNs = systemTime(SYSTEM_TIME_MONOTONIC);
+        mQuit = true;
+    }
+    mCond.notify_one();
+    mThread.join();
+
+    if (mHbmFd >= 0) {
+        close(mHbmFd);
+    }
+}
+
+void FodController::setFingerDown(bool down) {
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mWanted == down) {
+        return;
+    }
+    mWanted = down;
+    mRequestNs = systemTime(SYSTEM_TIME_MONOTONIC);
+    mCond.notify_one();
+}
+
+void FodController::setHbm(bool enabled) {
+    int value = enabled ? 1 : 0;
+    if (mHbmFd < 0 || mHbmValue == value) {
+        return;
+    }
+
+    const char* str = enabled ? "1" : "0";
+    if (pwrite(mHbmFd, str, 1, 0) != 1) {
+        ALOGE("Failed to write %s to %s: %s", str, FOD_HBM_PATH, strerror(errno));
+        mHbmValue = -1;
+        return;
+    }
+    mHbmValue = value;
+}
+
+void FodController::enter(bool active, int64_t requestNs) {
+    uint32_t param = 0;
+
+    int64_t startNs = systemTime(SYSTEM_TIME_MONOTONIC);
+    mDevice->do_extra_api_in(active ? FINGERPRINT_LGE_SCAN_START : FINGERPRINT_LGE_SCAN_STOP,
+                             &param);
+    int64_t scanNs = systemTime(SYSTEM_TIME_MONOTONIC);
+    setHbm(active);
+    int64_t hbmNs = systemTime(SYSTEM_TIME_MONOTONIC);
+
+    ALOGD("FOD %s: picked up after %" PRId64 "us, scan %s %" PRId64 "us, hbm %" PRId64 "us",
+          active ? "on" : "off", (startNs - requestNs) / 1000, active ? "start" : "stop",
+          (scanNs - startNs) / 1000, (hbmNs - scanNs) / 1000);
+}
+
+void FodController::threadLoop() {
+    pthread_setname_np(pthread_self(), "fod");
+    setpriority(PRIO_PROCESS, 0, ANDROID_PRIORITY_URGENT_DISPLAY);
+
+    std::unique_lock<std::mutex> lock(mLock);
+    for (;;) {
+        mCond.wait(lock, [this] { return mWanted != mActive || mQuit; });
+
+        if (mWanted != mActive) {
+            bool active = mWanted;
+            int64_t requestNs = mRequestNs;
+
+            lock.unlock();
+            enter(active, requestNs);
+            lock.lock();
+
+            mActive = active;
+            continue;
+        }
+
+        if (mQuit) {
+            return;
+        }
+    }
+}
+
+}  // namespace implementation
+}  // namespace V2_3
+}  // namespace fingerprint
+}  // namespace biometrics
+}  // namespace hardware
+}  // namespace android
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_HARDWARE_BIOMETRICS_FINGERPRINT_V2_3_FODCONTROLLER_H
+#define ANDROID_HARDWARE_BIOMETRICS_FINGERPRINT_V2_3_FODCONTROLLER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "fingerprint.h"
+
+namespace android {
+namespace hardware {
+namespace biometrics {
+namespace fingerprint {
+namespace V2_3 {
+namespace implementation {
+
+/*
+ * Drives the under-display sensor: local high brightness mode (LHBM) on the panel and
+ * scan start/stop in the vendor library.
+ *
+ * Callers only record whether the finger is down; a dedicated high priority thread runs
+ * the transitions, so neither binder threads nor the vendor notify thread wait on sysfs
+ * or the vendor library. A down/up pair that arrives before the thread gets to it
+ * collapses into nothing. The LHBM node is opened once and only written on changes.
+ *
+ * Each step of a transition is timestamped relative to the request and logged.
+ */
+class FodController {
+  public:
+    explicit FodController(fingerprint_device_t* device);
+    ~FodController();
+
+    void setFingerDown(bool down);
+
+  private:
+    void setHbm(bool enabled);
+    void enter(bool active, int64_t requestNs);
+    void threadLoop();
+
+    fingerprint_device_t* mDevice;
+    int mHbmFd;
+    int mHbmValue = -1;
+
+    std::mutex mLock;
+    std::condition_variable mCond;
+    bool mWanted = false;
+    bool mActive = false;
+    int64_t mRequestNs = 0;
+    bool mQuit = false;
+    std::thread mThread;
+};
+
+}  // namespace implementation
+}  // namespace V2_3
+}  // namespace fingerprint
+}  // namespace biometrics
+}  // namespace hardware
+}  // namespace android
+
+#endif  // ANDROID_HARDWARE_BIOMETRICS_FINGERPRINT_V2_3_FODCONTROLLER_H
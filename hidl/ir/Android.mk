@@ -36,6 +36,7 @@ LOCAL_SHARED_LIBRARIES := \
 
 LOCAL_SRC_FILES := \
     service.cpp \
+    CarrierRanges.cpp \
     ConsumerIr.cpp
 
 LOCAL_MODULE_TAGS := optional
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define LOG_TAG "ConsumerIrService"
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <log/log.h>
+
+#include <sstream>
+
+#include "CarrierRanges.h"
+
+namespace android {
+namespace hardware {
+namespace ir {
+namespace V1_0 {
+namespace implementation {
+
+// strtoul() alone would take signs and whitespace, and wrap "-1" around to ULONG_MAX
+static bool parseFrequency(const char** p, uint32_t* value) {
+    char* end;
+    unsigned long parsed;
+
+    if (!isdigit((unsigned char)**p)) {
+        return false;
+    }
+
+    errno = 0;
+    parsed = strtoul(*p, &end, 10);
+    if (errno != 0 || parsed == 0 || parsed > INT32_MAX) {
+        return false;
+    }
+
+    *value = (uint32_t)parsed;
+    *p = end;
+    return true;
+}
+
+std::vector<CarrierRange> parseCarrierRanges(const std::string& spec) {
+    std::vector<CarrierRange> ranges;
+    std::stringstream ss(spec);
+    std::string entry;
+
+    while (std::getline(ss, entry, ',')) {
+        const char* p = entry.c_str();
+        CarrierRange range;
+
+        if (!parseFrequency(&p, &range.min) || *p++ != '-' || !parseFrequency(&p, &range.max) ||
+            *p != '\0' || range.min > range.max) {
+            ALOGE("ignoring invalid carrier range '%s'", entry.c_str());
+            continue;
+        }
+        ranges.push_back(range);
+    }
+    return ranges;
+}
+
+}  // namespace implementation
+}  // namespace V1_0
+}  // namespace ir
+}  // namespace hardware
+}  // namespace android
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_HARDWARE_IR_V1_0_CARRIERRANGES_H
+#define ANDROID_HARDWARE_IR_V1_0_CARRIERRANGES_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace ir {
+namespace V1_0 {
+namespace implementation {
+
+struct CarrierRange {
+    uint32_t min;
+    uint32_t max;
+};
+
+/*
+ * Parses "min-max[,min-max...]" in Hz. Bounds are plain decimal numbers between 1 and
+ * INT32_MAX, since carrier frequencies arrive as int32_t. Invalid entries are logged and
+ * skipped.
+ */
+std::vector<CarrierRange> parseCarrierRanges(const std::string& spec);
+
+}  // namespace implementation
+}  // namespace V1_0
+}  // namespace ir
+}  // namespace hardware
+}  // namespace android
+
+#endif  // ANDROID_HARDWARE_IR_V1_0_CARRIERRANGES_H
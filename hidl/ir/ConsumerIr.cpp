@@ -16,11 +16,10 @@
  */
 #define LOG_TAG "ConsumerIrService"
 
-#include <fcntl.h>
-#include <linux/lirc.h>
-
+#include <cutils/properties.h>
 #include <log/log.h>
 
+#include "CarrierRanges.h"
 #include "ConsumerIr.h"
 
 namespace android {
@@ -33,14 +32,14 @@ namespace implementation {
 #define IR_DEVICE "/dev/ttyMSM1"
 #define LG_IR_BAUD_RATE 115200
 
+// Carrier ranges supported by the transmitter, as "min-max[,min-max...]" in Hz
+#define IR_CARRIER_RANGES_PROP "ro.vendor.ir.carrier_ranges"
+#define IR_CARRIER_RANGES_DEFAULT "25000-125000"
+
 extern "C" {
 extern int transmitIr(const char *dev, int baudRate, int frequency, int pattern[], int pattern_len);
 }
 
-static hidl_vec<ConsumerIrFreqRange> rangeVec{
-    {.min = 25000, .max = 125000},
-};
-
 enum LG_TRANSMIT_IR_RETURN_CODES {
     IR_SUCCESS,
     IR_FAIL,
@@ -54,12 +53,51 @@ enum LG_TRANSMIT_IR_RETURN_CODES {
     IR_MAX_DURATIONS_EXCEEDED
 };
 
-ConsumerIr::ConsumerIr() {}
+ConsumerIr::ConsumerIr() {
+    char spec[PROPERTY_VALUE_MAX];
+    property_get(IR_CARRIER_RANGES_PROP, spec, IR_CARRIER_RANGES_DEFAULT);
+
+    std::vector<CarrierRange> ranges = parseCarrierRanges(spec);
+    if (ranges.empty()) {
+        ranges = parseCarrierRanges(IR_CARRIER_RANGES_DEFAULT);
+    }
+
+    mCarrierRanges.resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); i++) {
+        mCarrierRanges[i] = {.min = ranges[i].min, .max = ranges[i].max};
+    }
+}
+
+bool ConsumerIr::isCarrierSupported(int32_t carrierFreq) {
+    for (const auto& range : mCarrierRanges) {
+        if (carrierFreq >= 0 && (uint32_t)carrierFreq >= range.min &&
+            (uint32_t)carrierFreq <= range.max) {
+            return true;
+        }
+    }
+    return false;
+}
 
 Return<bool> ConsumerIr::transmit(int32_t carrierFreq, const hidl_vec<int32_t>& pattern) {
+    if (!isCarrierSupported(carrierFreq)) {
+        ALOGE("carrier frequency %d Hz is not supported", carrierFreq);
+        return false;
+    }
+
     size_t entries = pattern.size();
     int rc;
 
+    if (entries == 0) {
+        ALOGE("refusing to transmit an empty pattern");
+        return false;
+    }
+    for (size_t i = 0; i < entries; i++) {
+        if (pattern[i] <= 0) {
+            ALOGE("invalid duration %d at index %zu", pattern[i], i);
+            return false;
+        }
+    }
+
     // call into libcir_driver
     ALOGD("transmitting pattern at %d Hz", carrierFreq);
     rc = transmitIr(IR_DEVICE, LG_IR_BAUD_RATE, carrierFreq, const_cast<int32_t*>(pattern.data()), sizeof(int32_t) * entries);
@@ -71,7 +109,7 @@ Return<bool> ConsumerIr::transmit(int32_t carrierFreq, const hidl_vec<int32_t>&
 }
 
 Return<void> ConsumerIr::getCarrierFreqs(getCarrierFreqs_cb _hidl_cb) {
-    _hidl_cb(true, rangeVec);
+    _hidl_cb(true, mCarrierRanges);
     return Void();
 }
 
@@ -39,6 +39,11 @@ class ConsumerIr : public IConsumerIr {
 
     Return<bool> transmit(int32_t carrierFreq, const hidl_vec<int32_t>& pattern) override;
     Return<void> getCarrierFreqs(getCarrierFreqs_cb _hidl_cb) override;
+
+   private:
+    bool isCarrierSupported(int32_t carrierFreq);
+
+    hidl_vec<ConsumerIrFreqRange> mCarrierRanges;
 };
 
 }  // namespace implementation
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "CarrierRanges.h"
+
+#include <gtest/gtest.h>
+
+namespace android {
+namespace hardware {
+namespace ir {
+namespace V1_0 {
+namespace implementation {
+namespace {
+
+testing::AssertionResult rangesAre(const std::string& spec,
+                                   const std::vector<CarrierRange>& expected) {
+    std::vector<CarrierRange> ranges = parseCarrierRanges(spec);
+    if (ranges.size() != expected.size()) {
+        return testing::AssertionFailure()
+               << "'" << spec << "': " << ranges.size() << " ranges, expected " << expected.size();
+    }
+    for (size_t i = 0; i < ranges.size(); i++) {
+        if (ranges[i].min != expected[i].min || ranges[i].max != expected[i].max) {
+            return testing::AssertionFailure()
+                   << "'" << spec << "' range " << i << ": " << ranges[i].min << "-"
+                   << ranges[i].max << ", expected " << expected[i].min << "-" << expected[i].max;
+        }
+    }
+    return testing::AssertionSuccess();
+}
+
+TEST(CarrierRangesTest, ParsesSingleRange) {
+    EXPECT_TRUE(rangesAre("25000-125000", {{25000, 125000}}));
+}
+
+TEST(CarrierRangesTest, ParsesList) {
+    EXPECT_TRUE(rangesAre("30000-30000,36000-40000,56000-57000",
+                          {{30000, 30000}, {36000, 40000}, {56000, 57000}}));
+}
+
+TEST(CarrierRangesTest, SkipsInvalidEntriesOnly) {
+    EXPECT_TRUE(rangesAre("40000-30000,36000-40000,junk", {{36000, 40000}}));
+}
+
+TEST(CarrierRangesTest, RejectsTrailingGarbage) {
+    EXPECT_TRUE(rangesAre("30000-40000kHz", {}));
+    EXPECT_TRUE(rangesAre("30000-40000-50000", {}));
+    EXPECT_TRUE(rangesAre("30000-40000 ", {}));
+}
+
+TEST(CarrierRangesTest, RejectsMinAboveMax) {
+    EXPECT_TRUE(rangesAre("40000-30000", {}));
+}
+
+TEST(CarrierRangesTest, RejectsZero) {
+    EXPECT_TRUE(rangesAre("0-40000", {}));
+    EXPECT_TRUE(rangesAre("0-0", {}));
+}
+
+TEST(CarrierRangesTest, RejectsSigns) {
+    // "%u" would read "-1" as UINT_MAX
+    EXPECT_TRUE(rangesAre("-1-5", {}));
+    EXPECT_TRUE(rangesAre("1--5", {}));
+    EXPECT_TRUE(rangesAre("+1-5", {}));
+    EXPECT_TRUE(rangesAre(" 1-5", {}));
+}
+
+TEST(CarrierRangesTest, RejectsFrequenciesBeyondInt32) {
+    EXPECT_TRUE(rangesAre("1-2147483647", {{1, 2147483647}}));
+    EXPECT_TRUE(rangesAre("1-2147483648", {}));
+    EXPECT_TRUE(rangesAre("1-99999999999999999999", {}));
+}
+
+TEST(CarrierRangesTest, RejectsIncompleteEntries) {
+    EXPECT_TRUE(rangesAre("", {}));
+    EXPECT_TRUE(rangesAre("30000", {}));
+    EXPECT_TRUE(rangesAre("30000-", {}));
+    EXPECT_TRUE(rangesAre("-40000", {}));
+    EXPECT_TRUE(rangesAre(",", {}));
+}
+
+}  // namespace
+}  // namespace implementation
+}  // namespace V1_0
+}  // namespace ir
+}  // namespace hardware
+}  // namespace android
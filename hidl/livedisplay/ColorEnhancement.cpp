@@ -7,25 +7,19 @@
 #include <livedisplay/lge/ColorEnhancement.h>
 
 #include <android-base/logging.h>
-#include <android-base/file.h>
-#include <android-base/strings.h>
 
 #include <fstream>
 
-using android::base::ReadFileToString;
-using android::base::Trim;
-using android::base::WriteStringToFile;
-
 namespace vendor {
 namespace lineage {
 namespace livedisplay {
 namespace V2_0 {
 namespace implementation {
 
-static constexpr const char* kModePath = "/sys/devices/virtual/panel/img_tune/hdr_mode";
 static constexpr const char* kDefaultPath = "/data/misc/display/default_hdr_mode";
 
-ColorEnhancement::ColorEnhancement() {
+ColorEnhancement::ColorEnhancement(std::shared_ptr<FeatureState> features)
+    : mFeatures(features) {
     std::ifstream defaultFile(kDefaultPath);
 
     defaultFile >> mDefaultColorEnhancement;
@@ -39,20 +33,11 @@ ColorEnhancement::ColorEnhancement() {
 
 // Methods from ::vendor::lineage::livedisplay::V2_0::IColorEnhancement follow.
 Return<bool> ColorEnhancement::isEnabled() {
-    std::string tmp;
-    int32_t contents = 0;
-
-    if (ReadFileToString(kModePath, &tmp)) {
-        contents = std::stoi(Trim(tmp));
-    }
-
-    return contents > 0;
+    return mFeatures->isEnabled(FeatureState::COLOR_ENHANCEMENT);
 }
 
 Return<bool> ColorEnhancement::setEnabled(bool enabled) {
-    WriteStringToFile(enabled ? "1" : "0", kModePath, true);
-
-    return WriteStringToFile(enabled ? "1" : "0", kModePath, true);
+    return mFeatures->setEnabled(FeatureState::COLOR_ENHANCEMENT, enabled);
 }
 
 }  // namespace implementation
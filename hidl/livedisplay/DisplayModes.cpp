@@ -6,7 +6,14 @@
 
 #include <livedisplay/lge/DisplayModes.h>
 #include <android-base/logging.h>
+#include <android-base/properties.h>
 #include <fstream>
+#include <iterator>
+#include <thread>
+
+#include <limits.h>
+#include <sys/inotify.h>
+#include <unistd.h>
 
 namespace vendor {
 namespace lineage {
@@ -17,86 +24,136 @@ namespace implementation {
 static constexpr const char* kModePath = "/sys/devices/virtual/panel/img_tune/screen_mode";
 static constexpr const char* kDefaultPath = "/data/misc/display/default_screen_mode";
 
-const std::map<int32_t, DisplayModes::ModeInfo> DisplayModes::kModeMap = {
-    {0, {"Cinema", "1"}},
-    {1, {"Sports", "4"}},
-    {2, {"Game", "5"}},
-    {3, {"Photos", "2"}},
-    {4, {"Web", "3"}},
-//    {5, {"Expert", "10"}},
+struct ModeInfo {
+    const char* name;
+    const char* value;
 };
 
-DisplayModes::DisplayModes() {
-    std::ifstream defaultFile(kDefaultPath);
+// Indexed by mode id.
+static constexpr ModeInfo kModes[] = {
+    {"Cinema", "1"},
+    {"Sports", "4"},
+    {"Game", "5"},
+    {"Photos", "2"},
+    {"Web", "3"},
+//    {"Expert", "10"},
+};
+
+static constexpr int32_t kNumModes = std::size(kModes);
+
+static bool modeIdForValue(const std::string& value, int32_t* modeId) {
+    for (int32_t i = 0; i < kNumModes; i++) {
+        if (value == kModes[i].value) {
+            *modeId = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool readModeId(const char* path, int32_t* modeId) {
+    std::ifstream file(path);
     std::string value;
 
-    defaultFile >> value;
-    LOG(DEBUG) << "Default file read result " << value << " fail " << defaultFile.fail();
-    if (defaultFile.fail()) {
+    file >> value;
+    return !file.fail() && modeIdForValue(value, modeId);
+}
+
+DisplayModes::DisplayModes() {
+    bool hasDefault = readModeId(kDefaultPath, &mDefaultModeId);
+    LOG(DEBUG) << "Default file read result " << mDefaultModeId << " fail " << !hasDefault;
+
+    if (hasDefault) {
+        setDisplayMode(mDefaultModeId, false);
+    } else if (!readModeId(kModePath, &mCurrentModeId)) {
+        mCurrentModeId = mDefaultModeId;
+    }
+
+    if (android::base::GetBoolProperty("ro.vendor.livedisplay.lge.watch_screen_mode", false)) {
+        // The service lives as long as the process, so the watcher is never joined.
+        std::thread(&DisplayModes::watchModeNode, this).detach();
+    }
+}
+
+void DisplayModes::watchModeNode() {
+    int fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0) {
+        PLOG(ERROR) << "Failed to initialize inotify";
         return;
     }
 
-    for (const auto& entry : kModeMap) {
-        if (value == entry.second.value) {
-            mDefaultModeId = entry.first;
-            break;
+    if (inotify_add_watch(fd, kModePath, IN_MODIFY | IN_CLOSE_WRITE) < 0) {
+        PLOG(ERROR) << "Failed to watch " << kModePath;
+        close(fd);
+        return;
+    }
+
+    char buf[sizeof(struct inotify_event) + NAME_MAX + 1];
+    while (TEMP_FAILURE_RETRY(read(fd, buf, sizeof(buf))) > 0) {
+        std::lock_guard<std::mutex> lock(mLock);
+        int32_t modeId;
+        if (readModeId(kModePath, &modeId) && modeId != mCurrentModeId) {
+            LOG(INFO) << "Screen mode changed externally to " << kModes[modeId].name;
+            mCurrentModeId = modeId;
         }
     }
 
-    setDisplayMode(mDefaultModeId, false);
+    PLOG(ERROR) << "Stopped watching " << kModePath;
+    close(fd);
 }
 
 // Methods from ::vendor::lineage::livedisplay::V2_0::IDisplayModes follow.
 Return<void> DisplayModes::getDisplayModes(getDisplayModes_cb resultCb) {
     std::vector<DisplayMode> modes;
-    for (const auto& entry : kModeMap) {
-        modes.push_back({entry.first, entry.second.name});
+    for (int32_t i = 0; i < kNumModes; i++) {
+        modes.push_back({i, kModes[i].name});
     }
     resultCb(modes);
     return Void();
 }
 
 Return<void> DisplayModes::getCurrentDisplayMode(getCurrentDisplayMode_cb resultCb) {
-    int32_t currentModeId = mDefaultModeId;
-    std::ifstream modeFile(kModePath);
-    std::string value;
-
-    modeFile >> value;
-    if (!modeFile.fail()) {
-        for (const auto& entry : kModeMap) {
-            if (value == entry.second.value) {
-                currentModeId = entry.first;
-                break;
-            }
-        }
+    int32_t currentModeId;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        currentModeId = mCurrentModeId;
     }
-    resultCb({currentModeId, kModeMap.at(currentModeId).name});
+    resultCb({currentModeId, kModes[currentModeId].name});
     return Void();
 }
 
 Return<void> DisplayModes::getDefaultDisplayMode(getDefaultDisplayMode_cb resultCb) {
-    resultCb({mDefaultModeId, kModeMap.at(mDefaultModeId).name});
+    int32_t defaultModeId;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        defaultModeId = mDefaultModeId;
+    }
+    resultCb({defaultModeId, kModes[defaultModeId].name});
     return Void();
 }
 
 Return<bool> DisplayModes::setDisplayMode(int32_t modeID, bool makeDefault) {
-    const auto iter = kModeMap.find(modeID);
-    if (iter == kModeMap.end()) {
+    if (modeID < 0 || modeID >= kNumModes) {
         return false;
     }
+
+    std::lock_guard<std::mutex> lock(mLock);
     std::ofstream modeFile(kModePath);
-    modeFile << iter->second.value;
+    modeFile << kModes[modeID].value;
+    modeFile.close();
     if (modeFile.fail()) {
         return false;
     }
+    mCurrentModeId = modeID;
 
     if (makeDefault) {
         std::ofstream defaultFile(kDefaultPath);
-        defaultFile << iter->second.value;
+        defaultFile << kModes[modeID].value;
+        defaultFile.close();
         if (defaultFile.fail()) {
             return false;
         }
-        mDefaultModeId = iter->first;
+        mDefaultModeId = modeID;
     }
     return true;
 }
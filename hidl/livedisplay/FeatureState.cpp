@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <livedisplay/lge/FeatureState.h>
+
+#include <android-base/file.h>
+#include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/strings.h>
+
+using android::base::ParseInt;
+using android::base::ReadFileToString;
+using android::base::Trim;
+using android::base::WriteStringToFile;
+
+namespace vendor {
+namespace lineage {
+namespace livedisplay {
+namespace V2_0 {
+namespace implementation {
+
+// Indexed by FeatureState::Feature.
+static constexpr const char* kFeaturePaths[FeatureState::FEATURE_COUNT] = {
+    "/sys/devices/virtual/panel/img_tune/hdr_mode",
+    "/sys/devices/virtual/panel/brightness/irc_brighter",
+};
+
+static bool readNode(const std::string& path, bool* enabled) {
+    std::string tmp;
+    int32_t contents;
+
+    if (!ReadFileToString(path, &tmp) || !ParseInt(Trim(tmp), &contents)) {
+        return false;
+    }
+
+    *enabled = contents > 0;
+    return true;
+}
+
+FeatureState::FeatureState(const std::string& root) {
+    for (size_t i = 0; i < FEATURE_COUNT; i++) {
+        mPaths[i] = root + kFeaturePaths[i];
+        if (!readNode(mPaths[i], &mEnabled[i])) {
+            LOG(ERROR) << "Failed to read " << mPaths[i];
+        }
+    }
+}
+
+bool FeatureState::writeNode(Feature feature, bool enabled) {
+    bool readback;
+
+    if (!WriteStringToFile(enabled ? "1" : "0", mPaths[feature], true)) {
+        PLOG(ERROR) << "Failed to write " << mPaths[feature];
+        return false;
+    }
+
+    if (!readNode(mPaths[feature], &readback) || readback != enabled) {
+        LOG(ERROR) << "Readback of " << mPaths[feature] << " does not match " << enabled;
+        return false;
+    }
+
+    return true;
+}
+
+bool FeatureState::isEnabled(Feature feature) {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mEnabled[feature];
+}
+
+bool FeatureState::setEnabled(Feature feature, bool enabled) {
+    return apply({{feature, enabled}});
+}
+
+bool FeatureState::apply(const std::vector<std::pair<Feature, bool>>& changes) {
+    std::lock_guard<std::mutex> lock(mLock);
+    std::array<bool, FEATURE_COUNT> target = mEnabled;
+    std::array<bool, FEATURE_COUNT> requested = {};
+    std::vector<Feature> written;
+
+    for (const auto& [feature, enabled] : changes) {
+        target[feature] = enabled;
+        requested[feature] = true;
+    }
+
+    for (size_t i = 0; i < FEATURE_COUNT; i++) {
+        Feature feature = static_cast<Feature>(i);
+        bool current;
+
+        if (!requested[i]) {
+            continue;
+        }
+
+        // Nodes already holding the value are left alone, rewriting them can make the panel
+        // flicker. The driver may have reset a node since it was cached, so ask the node.
+        if (target[i] == mEnabled[i] && readNode(mPaths[i], &current) && current == target[i]) {
+            continue;
+        }
+
+        if (!writeNode(feature, target[i])) {
+            for (Feature done : written) {
+                writeNode(done, mEnabled[done]);
+            }
+            // The failed node itself may be in any state now.
+            writeNode(feature, mEnabled[i]);
+            return false;
+        }
+        written.push_back(feature);
+    }
+
+    mEnabled = target;
+    return true;
+}
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace livedisplay
+}  // namespace lineage
+}  // namespace vendor
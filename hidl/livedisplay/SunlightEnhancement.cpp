@@ -10,7 +10,6 @@
 #include <android-base/properties.h>
 #include <string>
 #include <utils/Errors.h>
-#include <fstream>
 
 #include <livedisplay/lge/SunlightEnhancement.h>
 
@@ -20,22 +19,15 @@ namespace livedisplay {
 namespace V2_0 {
 namespace implementation {
 
-#define HBM_ENABLED  1
-#define HBM_DISABLED 0
-
-static constexpr const char* kHbmEnabledPath = "/sys/devices/virtual/panel/brightness/irc_brighter";
+SunlightEnhancement::SunlightEnhancement(std::shared_ptr<FeatureState> features)
+    : mFeatures(features) {}
 
 Return<bool> SunlightEnhancement::isEnabled() {
-    std::ifstream hbm_status_file(kHbmEnabledPath);
-    int result = -1;
-    hbm_status_file >> result;
-    return !hbm_status_file.fail() && result > 0;
+    return mFeatures->isEnabled(FeatureState::SUNLIGHT_ENHANCEMENT);
 }
 
 Return<bool> SunlightEnhancement::setEnabled(bool enabled) {
-    std::ofstream hbm_enable_file(kHbmEnabledPath);
-    hbm_enable_file << (enabled ? HBM_ENABLED : HBM_DISABLED);
-    return !hbm_enable_file.fail();
+    return mFeatures->setEnabled(FeatureState::SUNLIGHT_ENHANCEMENT, enabled);
 }
 
 }  // namespace implementation
@@ -11,6 +11,10 @@
 #include <hidl/Status.h>
 #include <vendor/lineage/livedisplay/2.0/IColorEnhancement.h>
 
+#include <livedisplay/lge/FeatureState.h>
+
+#include <memory>
+
 namespace vendor {
 namespace lineage {
 namespace livedisplay {
@@ -22,13 +26,14 @@ using ::android::hardware::Void;
 
 class ColorEnhancement : public IColorEnhancement {
   public:
-    ColorEnhancement();
+    explicit ColorEnhancement(std::shared_ptr<FeatureState> features);
 
     // Methods from ::vendor::lineage::livedisplay::V2_0::IColorEnhancement follow.
     Return<bool> isEnabled() override;
     Return<bool> setEnabled(bool enabled) override;
 
   private:
+    std::shared_ptr<FeatureState> mFeatures;
     int32_t mDefaultColorEnhancement;
 
 };
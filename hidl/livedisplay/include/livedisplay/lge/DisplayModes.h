@@ -10,7 +10,7 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 #include <vendor/lineage/livedisplay/2.0/IDisplayModes.h>
-#include <map>
+#include <mutex>
 
 namespace vendor {
 namespace lineage {
@@ -33,12 +33,13 @@ class DisplayModes : public IDisplayModes {
     Return<bool> setDisplayMode(int32_t modeID, bool makeDefault) override;
 
   private:
-    struct ModeInfo {
-        const char* name;
-        const char* value;
-    };
-    static const std::map<int32_t, ModeInfo> kModeMap;
-    int32_t mDefaultModeId;
+    void watchModeNode();
+
+    // The mode state is kept in memory and only read back from sysfs at startup, or when
+    // the node is written behind our back if watching is enabled.
+    std::mutex mLock;
+    int32_t mCurrentModeId = 0;
+    int32_t mDefaultModeId = 0;
 };
 
 }  // namespace sdm
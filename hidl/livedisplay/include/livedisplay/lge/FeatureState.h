@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VENDOR_LINEAGE_LIVEDISPLAY_V2_0_FEATURESTATE_H
+#define VENDOR_LINEAGE_LIVEDISPLAY_V2_0_FEATURESTATE_H
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vendor {
+namespace lineage {
+namespace livedisplay {
+namespace V2_0 {
+namespace implementation {
+
+/*
+ * Owns the on/off panel features shared by the LiveDisplay HALs.
+ *
+ * Node values are read once at startup and cached, so getters never touch sysfs.
+ * Changes are applied as a transaction: a requested node is only skipped when it still
+ * holds the requested value, each write is read back, and on failure the nodes already
+ * written are restored so the cache and the panel never disagree.
+ *
+ * Node paths are resolved under root, which allows running against a fake sysfs tree.
+ */
+class FeatureState {
+  public:
+    enum Feature { COLOR_ENHANCEMENT, SUNLIGHT_ENHANCEMENT, FEATURE_COUNT };
+
+    explicit FeatureState(const std::string& root = "");
+
+    bool isEnabled(Feature feature);
+    bool setEnabled(Feature feature, bool enabled);
+    bool apply(const std::vector<std::pair<Feature, bool>>& changes);
+
+  private:
+    bool writeNode(Feature feature, bool enabled);
+
+    std::array<std::string, FEATURE_COUNT> mPaths;
+
+    std::mutex mLock;
+    std::array<bool, FEATURE_COUNT> mEnabled = {};
+};
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace livedisplay
+}  // namespace lineage
+}  // namespace vendor
+
+#endif  // VENDOR_LINEAGE_LIVEDISPLAY_V2_0_FEATURESTATE_H
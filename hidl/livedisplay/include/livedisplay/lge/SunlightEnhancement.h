@@ -21,6 +21,10 @@
 #include <hidl/Status.h>
 #include <vendor/lineage/livedisplay/2.0/ISunlightEnhancement.h>
 
+#include <livedisplay/lge/FeatureState.h>
+
+#include <memory>
+
 namespace vendor {
 namespace lineage {
 namespace livedisplay {
@@ -33,9 +37,14 @@ using ::android::sp;
 
 class SunlightEnhancement : public ISunlightEnhancement {
   public:
+    explicit SunlightEnhancement(std::shared_ptr<FeatureState> features);
+
     // Methods from ::vendor::lineage::livedisplay::V2_0::ISunlightEnhancement follow.
     Return<bool> isEnabled() override;
     Return<bool> setEnabled(bool enabled) override;
+
+  private:
+    std::shared_ptr<FeatureState> mFeatures;
 };
 
 }  // namespace implementation
@@ -12,6 +12,7 @@
 
 #include <livedisplay/lge/ColorEnhancement.h>
 #include <livedisplay/lge/DisplayModes.h>
+#include <livedisplay/lge/FeatureState.h>
 #include <livedisplay/lge/SunlightEnhancement.h>
 
 #include <livedisplay/sdm/PictureAdjustment.h>
@@ -28,6 +29,7 @@ using ::vendor::lineage::livedisplay::V2_0::IPictureAdjustment;
 using ::vendor::lineage::livedisplay::V2_0::ISunlightEnhancement;
 using ::vendor::lineage::livedisplay::V2_0::implementation::ColorEnhancement;
 using ::vendor::lineage::livedisplay::V2_0::implementation::DisplayModes;
+using ::vendor::lineage::livedisplay::V2_0::implementation::FeatureState;
 using ::vendor::lineage::livedisplay::V2_0::implementation::SunlightEnhancement;
 
 using ::vendor::lineage::livedisplay::V2_0::sdm::PictureAdjustment;
@@ -41,11 +43,12 @@ int main() {
     LOG(INFO) << "LiveDisplay HAL service is starting.";
 
     std::shared_ptr<SDMController> controller = std::make_shared<SDMController>();
+    std::shared_ptr<FeatureState> features = std::make_shared<FeatureState>();
 
     // HIDL frontend
-    sp<ColorEnhancement> ce = new ColorEnhancement();;
+    sp<ColorEnhancement> ce = new ColorEnhancement(features);
     sp<DisplayModes> dm = new DisplayModes();
-    sp<SunlightEnhancement> se = new SunlightEnhancement();
+    sp<SunlightEnhancement> se = new SunlightEnhancement(features);
     sp<PictureAdjustment> pa = new PictureAdjustment(controller);
 
     if (ce == nullptr) {
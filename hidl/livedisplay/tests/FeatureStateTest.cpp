@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <livedisplay/lge/FeatureState.h>
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <filesystem>
+
+using android::base::ReadFileToString;
+using android::base::WriteStringToFile;
+
+namespace vendor {
+namespace lineage {
+namespace livedisplay {
+namespace V2_0 {
+namespace implementation {
+namespace {
+
+class FeatureStateTest : public ::testing::Test {
+  protected:
+    FeatureStateTest()
+        : mHdrMode(std::string(mRoot.path) + "/sys/devices/virtual/panel/img_tune/hdr_mode"),
+          mIrcBrighter(std::string(mRoot.path) +
+                       "/sys/devices/virtual/panel/brightness/irc_brighter") {
+        std::filesystem::create_directories(std::filesystem::path(mHdrMode).parent_path());
+        std::filesystem::create_directories(std::filesystem::path(mIrcBrighter).parent_path());
+    }
+
+    void set(const std::string& path, const std::string& value) {
+        ASSERT_TRUE(WriteStringToFile(value, path));
+    }
+
+    std::string get(const std::string& path) {
+        std::string value;
+        EXPECT_TRUE(ReadFileToString(path, &value)) << path;
+        return value;
+    }
+
+    std::unique_ptr<FeatureState> create() { return std::make_unique<FeatureState>(mRoot.path); }
+
+    TemporaryDir mRoot;
+    const std::string mHdrMode;
+    const std::string mIrcBrighter;
+};
+
+TEST_F(FeatureStateTest, ReadsInitialState) {
+    set(mHdrMode, "1\n");
+    set(mIrcBrighter, "0\n");
+    auto state = create();
+
+    EXPECT_TRUE(state->isEnabled(FeatureState::COLOR_ENHANCEMENT));
+    EXPECT_FALSE(state->isEnabled(FeatureState::SUNLIGHT_ENHANCEMENT));
+}
+
+TEST_F(FeatureStateTest, AppliesGroup) {
+    set(mHdrMode, "0");
+    set(mIrcBrighter, "0");
+    auto state = create();
+
+    EXPECT_TRUE(state->apply({{FeatureState::COLOR_ENHANCEMENT, true},
+                              {FeatureState::SUNLIGHT_ENHANCEMENT, true}}));
+    EXPECT_EQ("1", get(mHdrMode));
+    EXPECT_EQ("1", get(mIrcBrighter));
+    EXPECT_TRUE(state->isEnabled(FeatureState::COLOR_ENHANCEMENT));
+    EXPECT_TRUE(state->isEnabled(FeatureState::SUNLIGHT_ENHANCEMENT));
+}
+
+TEST_F(FeatureStateTest, LeavesMatchingNodesAlone) {
+    // A write would replace the newline
+    set(mHdrMode, "1\n");
+    set(mIrcBrighter, "0\n");
+    auto state = create();
+
+    EXPECT_TRUE(state->setEnabled(FeatureState::COLOR_ENHANCEMENT, true));
+    EXPECT_EQ("1\n", get(mHdrMode));
+    EXPECT_EQ("0\n", get(mIrcBrighter));
+}
+
+TEST_F(FeatureStateTest, RewritesDriftedNode) {
+    set(mHdrMode, "1\n");
+    set(mIrcBrighter, "1\n");
+    auto state = create();
+
+    // The driver reset both nodes behind the cache, only the requested one is fixed up
+    set(mHdrMode, "0\n");
+    set(mIrcBrighter, "0\n");
+    EXPECT_TRUE(state->setEnabled(FeatureState::COLOR_ENHANCEMENT, true));
+    EXPECT_EQ("1", get(mHdrMode));
+    EXPECT_EQ("0\n", get(mIrcBrighter));
+}
+
+TEST_F(FeatureStateTest, ReadbackMismatchRollsBack) {
+    // Writes follow the link but readback refuses it, so irc_brighter never reads back
+    std::string target = std::string(mRoot.path) + "/irc_brighter_target";
+    set(mHdrMode, "0");
+    set(target, "0");
+    ASSERT_EQ(0, symlink(target.c_str(), mIrcBrighter.c_str()));
+    auto state = create();
+
+    EXPECT_FALSE(state->apply({{FeatureState::COLOR_ENHANCEMENT, true},
+                               {FeatureState::SUNLIGHT_ENHANCEMENT, true}}));
+    EXPECT_EQ("0", get(mHdrMode));
+    EXPECT_EQ("0", get(target));
+    EXPECT_FALSE(state->isEnabled(FeatureState::COLOR_ENHANCEMENT));
+    EXPECT_FALSE(state->isEnabled(FeatureState::SUNLIGHT_ENHANCEMENT));
+}
+
+TEST_F(FeatureStateTest, WriteFailureRollsBack) {
+    set(mHdrMode, "0");
+    std::filesystem::create_directory(mIrcBrighter);
+    auto state = create();
+
+    EXPECT_FALSE(state->apply({{FeatureState::COLOR_ENHANCEMENT, true},
+                               {FeatureState::SUNLIGHT_ENHANCEMENT, true}}));
+    EXPECT_EQ("0", get(mHdrMode));
+    EXPECT_FALSE(state->isEnabled(FeatureState::COLOR_ENHANCEMENT));
+
+    // Unrelated changes still go through afterwards
+    EXPECT_TRUE(state->setEnabled(FeatureState::COLOR_ENHANCEMENT, true));
+    EXPECT_EQ("1", get(mHdrMode));
+}
+
+}  // namespace
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace livedisplay
+}  // namespace lineage
+}  // namespace vendor
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "DispatchTracker.h"
+
+#include <stdio.h>
+
+namespace android::hardware::radio::implementation {
+
+static constexpr const char* kPathNames[DispatchTracker::PATH_COUNT] = {
+        "request",
+        "response",
+        "indication",
+};
+
+std::atomic<size_t> DispatchTracker::sPoolSize = 0;
+std::atomic<uint32_t> DispatchTracker::sActive = 0;
+std::atomic<uint32_t> DispatchTracker::sPeak = 0;
+std::atomic<uint64_t> DispatchTracker::sSaturated = 0;
+
+DispatchTracker::Scope::Scope(DispatchTracker* tracker, Path path)
+    : mTracker(tracker), mPath(path) {
+    if (mTracker == nullptr) {
+        return;
+    }
+
+    PathStats& stats = mTracker->mPaths[mPath];
+    stats.calls++;
+    updatePeak(stats.peak, ++stats.active);
+
+    uint32_t active = ++sActive;
+    updatePeak(sPeak, active);
+    if (active >= sPoolSize) {
+        sSaturated++;
+    }
+}
+
+DispatchTracker::Scope::~Scope() {
+    if (mTracker == nullptr) {
+        return;
+    }
+
+    mTracker->mPaths[mPath].active--;
+    sActive--;
+}
+
+DispatchTracker::DispatchTracker(int slotId) : mSlotId(slotId) {}
+
+void DispatchTracker::setPoolSize(size_t threads) {
+    sPoolSize = threads;
+}
+
+void DispatchTracker::updatePeak(std::atomic<uint32_t>& peak, uint32_t value) {
+    uint32_t current = peak;
+    while (value > current && !peak.compare_exchange_weak(current, value)) {
+    }
+}
+
+void DispatchTracker::dump(int fd) {
+    dprintf(fd, "Binder thread pool: size=%zu active=%u peak=%u saturated=%llu\n",
+            sPoolSize.load(), sActive.load(), sPeak.load(),
+            (unsigned long long)sSaturated.load());
+
+    dprintf(fd, "Radio slot %d dispatch\n", mSlotId);
+    for (int path = 0; path < PATH_COUNT; path++) {
+        const PathStats& stats = mPaths[path];
+        dprintf(fd, "  %-10s active=%u peak=%u calls=%llu\n", kPathNames[path],
+                stats.active.load(), stats.peak.load(), (unsigned long long)stats.calls.load());
+    }
+}
+
+}  // namespace android::hardware::radio::implementation
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace android::hardware::radio::implementation {
+
+/*
+ * Binder thread pool occupancy, broken down per slot and per dispatch path.
+ *
+ * Every path of every slot is a separate binder node (Radio for requests, RadioResponse and
+ * LgeRadioResponseV2 for responses, RadioIndication and LgeRadioIndicationV2 for
+ * indications). Oneway transactions to a node are serialised by the binder driver, so each
+ * node occupies at most one pool thread at a time. Indications can therefore hold at most
+ * kIndicationNodesPerSlot threads per slot, however hard they flood; threadsForSlots() keeps
+ * two threads beyond that for requests, responses and IBase traffic such as debug().
+ */
+class DispatchTracker {
+  public:
+    enum Path { REQUEST, RESPONSE, INDICATION, PATH_COUNT };
+
+    class Scope {
+      public:
+        Scope(DispatchTracker* tracker, Path path);
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope();
+
+      private:
+        DispatchTracker* mTracker;
+        Path mPath;
+    };
+
+    explicit DispatchTracker(int slotId);
+
+    // The same count the service always used for sim_num slots, now for the slots that came up.
+    static constexpr size_t kIndicationNodesPerSlot = 2;
+    static constexpr size_t threadsForSlots(size_t slots) {
+        return slots * kIndicationNodesPerSlot + 2;
+    }
+
+    static void setPoolSize(size_t threads);
+
+    void dump(int fd);
+
+  private:
+    struct PathStats {
+        std::atomic<uint32_t> active = 0;
+        std::atomic<uint32_t> peak = 0;
+        std::atomic<uint64_t> calls = 0;
+    };
+
+    static void updatePeak(std::atomic<uint32_t>& peak, uint32_t value);
+
+    const int mSlotId;
+    std::array<PathStats, PATH_COUNT> mPaths;
+
+    // The binder thread pool is shared by all slots.
+    static std::atomic<size_t> sPoolSize;
+    static std::atomic<uint32_t> sActive;
+    static std::atomic<uint32_t> sPeak;
+    static std::atomic<uint64_t> sSaturated;
+};
+
+}  // namespace android::hardware::radio::implementation
@@ -11,6 +11,10 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 
+#include "DispatchTracker.h"
+
+#include <memory>
+
 namespace vendor::lge::hardware::radio::implementation {
 
 using ::android::hardware::hidl_array;
@@ -21,6 +25,8 @@ using ::android::hardware::Return;
 using ::android::hardware::Void;
 using ::android::sp;
 
+using ::android::hardware::radio::implementation::DispatchTracker;
+
 using ::android::hardware::radio::V1_4::IRadioIndication;
 using ::android::hardware::radio::V1_0::RadioIndicationType;
 
@@ -35,7 +41,8 @@ using ::vendor::lge::hardware::radio::V2_0::DataPdnThrottleIndInfo;
 
 struct LgeRadioIndicationV2 : public V2_0::ILgeRadioIndicationV2 {
 public:
-    LgeRadioIndicationV2(const sp<IRadioIndication>& radioIndication);
+    LgeRadioIndicationV2(const sp<IRadioIndication>& radioIndication,
+                         const std::shared_ptr<DispatchTracker>& dispatch);
 
     // Methods from ::vendor::lge::hardware::radio::V2_0::ILgeRadioIndicationV2 follow.
     Return<void> testLgeRadioIndication(int32_t serial) override;
@@ -97,6 +104,7 @@ public:
 
 private:
     sp<IRadioIndication> mRadioIndication;
+    std::shared_ptr<DispatchTracker> mDispatch;
 };
 
 }  // namespace vendor::lge::hardware::radio::implementation
@@ -13,6 +13,11 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 
+#include "DispatchTracker.h"
+#include "RequestTracer.h"
+
+#include <memory>
+
 namespace vendor::lge::hardware::radio::implementation {
 
 using ::android::hardware::hidl_array;
@@ -23,6 +28,9 @@ using ::android::hardware::Return;
 using ::android::hardware::Void;
 using ::android::sp;
 
+using ::android::hardware::radio::implementation::DispatchTracker;
+using ::android::hardware::radio::implementation::RequestTracer;
+
 using ::android::hardware::radio::V1_4::IRadioResponse;
 using ::android::hardware::radio::V1_0::RadioResponseInfo;
 using ::android::hardware::radio::V1_0::IccIoResult;
@@ -41,7 +49,9 @@ using ::vendor::lge::hardware::radio::V2_0::DataRegStateResult_1_4;
 using ::vendor::lge::hardware::radio::V2_0::LgeCardStatus;
 
 struct LgeRadioResponseV2 : public V2_0::ILgeRadioResponseV2 {
-    LgeRadioResponseV2(const sp<IRadioResponse>& radioResponse);
+    LgeRadioResponseV2(const sp<IRadioResponse>& radioResponse,
+                       const std::shared_ptr<RequestTracer>& tracer,
+                       const std::shared_ptr<DispatchTracker>& dispatch);
     // Methods from ::vendor::lge::hardware::radio::V2_0::ILgeRadioResponseV2 follow.
     Return<void> testLgeRadioInterfaceResponse(const RadioResponseInfo& info, int32_t serial) override;
     Return<void> PBMReadRecordResponse(const RadioResponseInfo& info, const LgePbmRecords& recordInfo) override;
@@ -130,6 +140,8 @@ struct LgeRadioResponseV2 : public V2_0::ILgeRadioResponseV2 {
 
 private:
     sp<IRadioResponse> mRadioResponse;
+    std::shared_ptr<RequestTracer> mTracer;
+    std::shared_ptr<DispatchTracker> mDispatch;
 };
 
 }  // namespace vendor::lge::hardware::radio::implementation
@@ -13,51 +13,86 @@
 
 #include <android-base/logging.h>
 
-#define WRAP_V1_0_CALL(method, ...)                                            \
-    do {                                                                       \
-        auto realRadio = mRealRadio;                                           \
-        if (realRadio != nullptr) {                                            \
-            return realRadio->method(__VA_ARGS__);                             \
-        }                                                                      \
-        return Status::fromExceptionCode(Status::Exception::EX_ILLEGAL_STATE); \
+#define WRAP_V1_0_CALL(method, ...)                                                     \
+    do {                                                                                \
+        auto realRadio = mRealRadio;                                                    \
+        if (realRadio != nullptr) {                                                     \
+            DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::REQUEST); \
+            auto trace = mTracer->traceRequest(__func__, ##__VA_ARGS__);                \
+            return realRadio->method(__VA_ARGS__);                                      \
+        }                                                                               \
+        return Status::fromExceptionCode(Status::Exception::EX_ILLEGAL_STATE);          \
     } while (0)
 
-#define MAYBE_WRAP_V1_1_CALL(method, ...)               \
-    do {                                                \
-        auto realRadio_V1_1 = getRealRadio_V1_1();      \
-        if (realRadio_V1_1 != nullptr) {                \
-            return realRadio_V1_1->method(__VA_ARGS__); \
-        }                                               \
+#define MAYBE_WRAP_V1_1_CALL(method, ...)                                               \
+    do {                                                                                \
+        auto realRadio_V1_1 = getRealRadio_V1_1();                                      \
+        if (realRadio_V1_1 != nullptr) {                                                \
+            DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::REQUEST); \
+            auto trace = mTracer->traceRequest(__func__, ##__VA_ARGS__);                \
+            return realRadio_V1_1->method(__VA_ARGS__);                                 \
+        }                                                                               \
     } while (0)
 
-#define MAYBE_WRAP_V1_2_CALL(method, ...)               \
-    do {                                                \
-        auto realRadio_V1_2 = getRealRadio_V1_2();      \
-        if (realRadio_V1_2 != nullptr) {                \
-            return realRadio_V1_2->method(__VA_ARGS__); \
-        }                                               \
+#define MAYBE_WRAP_V1_2_CALL(method, ...)                                               \
+    do {                                                                                \
+        auto realRadio_V1_2 = getRealRadio_V1_2();                                      \
+        if (realRadio_V1_2 != nullptr) {                                                \
+            DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::REQUEST); \
+            auto trace = mTracer->traceRequest(__func__, ##__VA_ARGS__);                \
+            return realRadio_V1_2->method(__VA_ARGS__);                                 \
+        }                                                                               \
     } while (0)
 
-#define MAYBE_WRAP_V1_3_CALL(method, ...)               \
-    do {                                                \
-        auto realRadio_V1_3 = getRealRadio_V1_3();      \
-        if (realRadio_V1_3 != nullptr) {                \
-            return realRadio_V1_3->method(__VA_ARGS__); \
-        }                                               \
+#define MAYBE_WRAP_V1_3_CALL(method, ...)                                               \
+    do {                                                                                \
+        auto realRadio_V1_3 = getRealRadio_V1_3();                                      \
+        if (realRadio_V1_3 != nullptr) {                                                \
+            DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::REQUEST); \
+            auto trace = mTracer->traceRequest(__func__, ##__VA_ARGS__);                \
+            return realRadio_V1_3->method(__VA_ARGS__);                                 \
+        }                                                                               \
     } while (0)
 
-#define MAYBE_WRAP_V1_4_CALL(method, ...)                    \
-    do {                                                     \
-        auto realRadio_V1_4 = getRealRadio_V1_4();           \
-        if (realRadio_V1_4 != nullptr) {                     \
-            return realRadio_V1_4->method(__VA_ARGS__);      \
-        }                                                    \
+#define MAYBE_WRAP_V1_4_CALL(method, ...)                                               \
+    do {                                                                                \
+        auto realRadio_V1_4 = getRealRadio_V1_4();                                      \
+        if (realRadio_V1_4 != nullptr) {                                                \
+            DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::REQUEST); \
+            auto trace = mTracer->traceRequest(__func__, ##__VA_ARGS__);                \
+            return realRadio_V1_4->method(__VA_ARGS__);                                 \
+        }                                                                               \
     } while (0)
 
 namespace android::hardware::radio::implementation {
 
-Radio::Radio(sp<V1_0::IRadio> realRadio, int slotId) : mRealRadio(realRadio) {
+Radio::Radio(sp<V1_0::IRadio> realRadio, int slotId, sp<ILgeRadio> lgeRadio)
+    : mRealRadio(realRadio),
+      mLgeRadio(lgeRadio),
+      mTracer(std::make_shared<RequestTracer>(slotId)),
+      mDispatch(std::make_shared<DispatchTracker>(slotId)) {
     mSlotId = slotId;
+    mRadioResponse->mTracer = mTracer;
+    mRadioResponse->mDispatch = mDispatch;
+    mRadioIndication->mDispatch = mDispatch;
+}
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+Return<void> Radio::debug(const hidl_handle& fd, const hidl_vec<hidl_string>& options) {
+    if (fd == nullptr || fd->numFds < 1) {
+        return Void();
+    }
+
+    bool reset = false;
+    for (const auto& option : options) {
+        if (option == "--reset") {
+            reset = true;
+        }
+    }
+
+    mDispatch->dump(fd->data[0]);
+    mTracer->dump(fd->data[0], reset);
+    return Void();
 }
 
 // Methods from ::android::hardware::radio::V1_0::IRadio follow.
@@ -68,11 +103,18 @@ Return<void> Radio::setResponseFunctions(const sp<V1_0::IRadioResponse>& radioRe
 
     // We also need to do some funny for LgeRadio here.
     mLgeRadioResponse = new LgeRadioResponseV2(
-        V1_4::IRadioResponse::castFrom(radioResponse).withDefault(nullptr));
+        V1_4::IRadioResponse::castFrom(radioResponse).withDefault(nullptr), mTracer, mDispatch);
     mLgeRadioIndication = new LgeRadioIndicationV2(
-        V1_4::IRadioIndication::castFrom(radioIndication).withDefault(nullptr));
-    auto svc = ILgeRadio::getService("lge_radio" + (mSlotId != 1 ? std::to_string(mSlotId) : ""));
-    svc->setResponseFunctions(mLgeRadioResponse, mLgeRadioIndication);
+        V1_4::IRadioIndication::castFrom(radioIndication).withDefault(nullptr), mDispatch);
+    auto svc = mLgeRadio;
+    if (svc == nullptr) {
+        svc = ILgeRadio::getService("lge_radio" + (mSlotId != 1 ? std::to_string(mSlotId) : ""));
+    }
+    if (svc != nullptr) {
+        svc->setResponseFunctions(mLgeRadioResponse, mLgeRadioIndication);
+    } else {
+        LOG(ERROR) << "Cannot get LGE radio service for slot " << mSlotId;
+    }
 
     // Finally, set up radio
     WRAP_V1_0_CALL(setResponseFunctions, mRadioResponse, mRadioIndication);
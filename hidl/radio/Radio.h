@@ -10,8 +10,10 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 
+#include "DispatchTracker.h"
 #include "RadioIndication.h"
 #include "RadioResponse.h"
+#include "RequestTracer.h"
 
 #include <vendor/lge/hardware/radio/2.0/ILgeRadio.h>
 #include "LgeRadioIndicationV2.h"
@@ -21,6 +23,7 @@ namespace android::hardware::radio::implementation {
 
 using ::android::sp;
 using ::android::hardware::hidl_array;
+using ::android::hardware::hidl_handle;
 using ::android::hardware::hidl_memory;
 using ::android::hardware::hidl_string;
 using ::android::hardware::hidl_vec;
@@ -35,7 +38,10 @@ using vendor::lge::hardware::radio::implementation::LgeRadioResponseV2;
 
 struct Radio : public V1_4::IRadio {
   public:
-    Radio(sp<V1_0::IRadio> realRadio, int slotId);
+    Radio(sp<V1_0::IRadio> realRadio, int slotId, sp<ILgeRadio> lgeRadio = nullptr);
+
+    // Methods from ::android::hidl::base::V1_0::IBase follow.
+    Return<void> debug(const hidl_handle& fd, const hidl_vec<hidl_string>& options) override;
 
     // Methods from ::android::hardware::radio::V1_0::IRadio follow.
     Return<void> setResponseFunctions(const sp<V1_0::IRadioResponse>& radioResponse,
@@ -272,6 +278,9 @@ struct Radio : public V1_4::IRadio {
   private:
     int mSlotId;
     sp<V1_0::IRadio> mRealRadio;
+    sp<ILgeRadio> mLgeRadio;
+    std::shared_ptr<RequestTracer> mTracer;
+    std::shared_ptr<DispatchTracker> mDispatch;
     sp<RadioResponse> mRadioResponse = new RadioResponse();
     sp<RadioIndication> mRadioIndication = new RadioIndication();
     sp<LgeRadioResponseV2> mLgeRadioResponse;
@@ -12,47 +12,57 @@ namespace android::hardware::radio::implementation {
 // Methods from ::android::hardware::radio::V1_0::IRadioIndication follow.
 Return<void> RadioIndication::radioStateChanged(V1_0::RadioIndicationType type,
                                                 V1_0::RadioState radioState) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->radioStateChanged(type, radioState);
 }
 
 Return<void> RadioIndication::callStateChanged(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->callStateChanged(type);
 }
 
 Return<void> RadioIndication::networkStateChanged(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->networkStateChanged(type);
 }
 
 Return<void> RadioIndication::newSms(V1_0::RadioIndicationType type, const hidl_vec<uint8_t>& pdu) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->newSms(type, pdu);
 }
 
 Return<void> RadioIndication::newSmsStatusReport(V1_0::RadioIndicationType type,
                                                  const hidl_vec<uint8_t>& pdu) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->newSmsStatusReport(type, pdu);
 }
 
 Return<void> RadioIndication::newSmsOnSim(V1_0::RadioIndicationType type, int32_t recordNumber) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->newSmsOnSim(type, recordNumber);
 }
 
 Return<void> RadioIndication::onUssd(V1_0::RadioIndicationType type, V1_0::UssdModeType modeType,
                                      const hidl_string& msg) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->onUssd(type, modeType, msg);
 }
 
 Return<void> RadioIndication::nitzTimeReceived(V1_0::RadioIndicationType type,
                                                const hidl_string& nitzTime, uint64_t receivedTime) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->nitzTimeReceived(type, nitzTime, receivedTime);
 }
 
 Return<void> RadioIndication::currentSignalStrength(V1_0::RadioIndicationType type,
                                                     const V1_0::SignalStrength& signalStrength) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentSignalStrength_1_4(type, Create1_4SignalStrength(signalStrength));
 }
 
 Return<void> RadioIndication::dataCallListChanged(
         V1_0::RadioIndicationType type, const hidl_vec<V1_0::SetupDataCallResult>& dcList) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     hidl_vec<V1_4::SetupDataCallResult> newDcList;
     newDcList.resize(dcList.size());
     for(int x = 0; x < dcList.size(); ++x)
@@ -62,174 +72,211 @@ Return<void> RadioIndication::dataCallListChanged(
 
 Return<void> RadioIndication::suppSvcNotify(V1_0::RadioIndicationType type,
                                             const V1_0::SuppSvcNotification& suppSvc) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->suppSvcNotify(type, suppSvc);
 }
 
 Return<void> RadioIndication::stkSessionEnd(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->stkSessionEnd(type);
 }
 
 Return<void> RadioIndication::stkProactiveCommand(V1_0::RadioIndicationType type,
                                                   const hidl_string& cmd) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->stkProactiveCommand(type, cmd);
 }
 
 Return<void> RadioIndication::stkEventNotify(V1_0::RadioIndicationType type,
                                              const hidl_string& cmd) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->stkEventNotify(type, cmd);
 }
 
 Return<void> RadioIndication::stkCallSetup(V1_0::RadioIndicationType type, int64_t timeout) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->stkCallSetup(type, timeout);
 }
 
 Return<void> RadioIndication::simSmsStorageFull(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->simSmsStorageFull(type);
 }
 
 Return<void> RadioIndication::simRefresh(V1_0::RadioIndicationType type,
                                          const V1_0::SimRefreshResult& refreshResult) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->simRefresh(type, refreshResult);
 }
 
 Return<void> RadioIndication::callRing(V1_0::RadioIndicationType type, bool isGsm,
                                        const V1_0::CdmaSignalInfoRecord& record) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->callRing(type, isGsm, record);
 }
 
 Return<void> RadioIndication::simStatusChanged(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->simStatusChanged(type);
 }
 
 Return<void> RadioIndication::cdmaNewSms(V1_0::RadioIndicationType type,
                                          const V1_0::CdmaSmsMessage& msg) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaNewSms(type, msg);
 }
 
 Return<void> RadioIndication::newBroadcastSms(V1_0::RadioIndicationType type,
                                               const hidl_vec<uint8_t>& data) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->newBroadcastSms(type, data);
 }
 
 Return<void> RadioIndication::cdmaRuimSmsStorageFull(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaRuimSmsStorageFull(type);
 }
 
 Return<void> RadioIndication::restrictedStateChanged(V1_0::RadioIndicationType type,
                                                      V1_0::PhoneRestrictedState state) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->restrictedStateChanged(type, state);
 }
 
 Return<void> RadioIndication::enterEmergencyCallbackMode(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->enterEmergencyCallbackMode(type);
 }
 
 Return<void> RadioIndication::cdmaCallWaiting(V1_0::RadioIndicationType type,
                                               const V1_0::CdmaCallWaiting& callWaitingRecord) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaCallWaiting(type, callWaitingRecord);
 }
 
 Return<void> RadioIndication::cdmaOtaProvisionStatus(V1_0::RadioIndicationType type,
                                                      V1_0::CdmaOtaProvisionStatus status) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaOtaProvisionStatus(type, status);
 }
 
 Return<void> RadioIndication::cdmaInfoRec(V1_0::RadioIndicationType type,
                                           const V1_0::CdmaInformationRecords& records) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaInfoRec(type, records);
 }
 
 Return<void> RadioIndication::indicateRingbackTone(V1_0::RadioIndicationType type, bool start) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->indicateRingbackTone(type, start);
 }
 
 Return<void> RadioIndication::resendIncallMute(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->resendIncallMute(type);
 }
 
 Return<void> RadioIndication::cdmaSubscriptionSourceChanged(
         V1_0::RadioIndicationType type, V1_0::CdmaSubscriptionSource cdmaSource) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaSubscriptionSourceChanged(type, cdmaSource);
 }
 
 Return<void> RadioIndication::cdmaPrlChanged(V1_0::RadioIndicationType type, int32_t version) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cdmaPrlChanged(type, version);
 }
 
 Return<void> RadioIndication::exitEmergencyCallbackMode(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->exitEmergencyCallbackMode(type);
 }
 
 Return<void> RadioIndication::rilConnected(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->rilConnected(type);
 }
 
 Return<void> RadioIndication::voiceRadioTechChanged(V1_0::RadioIndicationType type,
                                                     V1_0::RadioTechnology rat) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->voiceRadioTechChanged(type, rat);
 }
 
 Return<void> RadioIndication::cellInfoList(V1_0::RadioIndicationType type,
                                            const hidl_vec<V1_0::CellInfo>& records) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cellInfoList_1_4(type, Create1_4CellInfoList(records));
 }
 
 Return<void> RadioIndication::imsNetworkStateChanged(V1_0::RadioIndicationType type) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->imsNetworkStateChanged(type);
 }
 
 Return<void> RadioIndication::subscriptionStatusChanged(V1_0::RadioIndicationType type,
                                                         bool activate) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->subscriptionStatusChanged(type, activate);
 }
 
 Return<void> RadioIndication::srvccStateNotify(V1_0::RadioIndicationType type,
                                                V1_0::SrvccState state) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->srvccStateNotify(type, state);
 }
 
 Return<void> RadioIndication::hardwareConfigChanged(V1_0::RadioIndicationType type,
                                                     const hidl_vec<V1_0::HardwareConfig>& configs) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->hardwareConfigChanged(type, configs);
 }
 
 Return<void> RadioIndication::radioCapabilityIndication(V1_0::RadioIndicationType type,
                                                         const V1_0::RadioCapability& rc) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->radioCapabilityIndication(type, rc);
 }
 
 Return<void> RadioIndication::onSupplementaryServiceIndication(V1_0::RadioIndicationType type,
                                                                const V1_0::StkCcUnsolSsResult& ss) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->onSupplementaryServiceIndication(type, ss);
 }
 
 Return<void> RadioIndication::stkCallControlAlphaNotify(V1_0::RadioIndicationType type,
                                                         const hidl_string& alpha) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->stkCallControlAlphaNotify(type, alpha);
 }
 
 Return<void> RadioIndication::lceData(V1_0::RadioIndicationType type,
                                       const V1_0::LceDataInfo& lce) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->lceData(type, lce);
 }
 
 Return<void> RadioIndication::pcoData(V1_0::RadioIndicationType type,
                                       const V1_0::PcoDataInfo& pco) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->pcoData(type, pco);
 }
 
 Return<void> RadioIndication::modemReset(V1_0::RadioIndicationType type,
                                          const hidl_string& reason) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->modemReset(type, reason);
 }
 
 // Methods from ::android::hardware::radio::V1_1::IRadioIndication follow.
 Return<void> RadioIndication::carrierInfoForImsiEncryption(V1_0::RadioIndicationType info) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->carrierInfoForImsiEncryption(info);
 }
 
 Return<void> RadioIndication::networkScanResult(V1_0::RadioIndicationType type,
                                                 const V1_1::NetworkScanResult& result) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     V1_4::NetworkScanResult newNSR = {};
     newNSR.status = result.status;
     newNSR.error = result.error;
@@ -239,12 +286,14 @@ Return<void> RadioIndication::networkScanResult(V1_0::RadioIndicationType type,
 
 Return<void> RadioIndication::keepaliveStatus(V1_0::RadioIndicationType type,
                                               const V1_1::KeepaliveStatus& status) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->keepaliveStatus(type, status);
 }
 
 // Methods from ::android::hardware::radio::V1_2::IRadioIndication follow.
 Return<void> RadioIndication::networkScanResult_1_2(V1_0::RadioIndicationType type,
                                                     const V1_2::NetworkScanResult& result) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     V1_4::NetworkScanResult newNSR = {};
     newNSR.status = result.status;
     newNSR.error = result.error;
@@ -254,16 +303,19 @@ Return<void> RadioIndication::networkScanResult_1_2(V1_0::RadioIndicationType ty
 
 Return<void> RadioIndication::cellInfoList_1_2(V1_0::RadioIndicationType type,
                                                const hidl_vec<V1_2::CellInfo>& records) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cellInfoList_1_4(type, Create1_4CellInfoList(records));
 }
 
 Return<void> RadioIndication::currentLinkCapacityEstimate(V1_0::RadioIndicationType type,
                                                           const V1_2::LinkCapacityEstimate& lce) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentLinkCapacityEstimate(type, lce);
 }
 
 Return<void> RadioIndication::currentPhysicalChannelConfigs(
         V1_0::RadioIndicationType type, const hidl_vec<V1_2::PhysicalChannelConfig>& configs) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     hidl_vec<V1_4::PhysicalChannelConfig> newConfigs;
     newConfigs.resize(configs.size());
     for(int x = 0; x < configs.size(); ++x){
@@ -276,6 +328,7 @@ Return<void> RadioIndication::currentPhysicalChannelConfigs(
 
 Return<void> RadioIndication::currentSignalStrength_1_2(
         V1_0::RadioIndicationType type, const V1_2::SignalStrength& signalStrength) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentSignalStrength_1_4(type, Create1_4SignalStrength(signalStrength));
 }
 
@@ -283,31 +336,37 @@ Return<void> RadioIndication::currentSignalStrength_1_2(
 Return<void> RadioIndication::currentEmergencyNumberList(
         V1_0::RadioIndicationType type,
         const hidl_vec<V1_4::EmergencyNumber>& emergencyNumberList) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentEmergencyNumberList(type, emergencyNumberList);
 }
 
 Return<void> RadioIndication::cellInfoList_1_4(V1_0::RadioIndicationType type,
                                                const hidl_vec<V1_4::CellInfo>& records) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->cellInfoList_1_4(type, records);
 }
 
 Return<void> RadioIndication::networkScanResult_1_4(V1_0::RadioIndicationType type,
                                                     const V1_4::NetworkScanResult& result) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->networkScanResult_1_4(type, result);
 }
 
 Return<void> RadioIndication::currentPhysicalChannelConfigs_1_4(
         V1_0::RadioIndicationType type, const hidl_vec<V1_4::PhysicalChannelConfig>& configs) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentPhysicalChannelConfigs_1_4(type, configs);
 }
 
 Return<void> RadioIndication::dataCallListChanged_1_4(
         V1_0::RadioIndicationType type, const hidl_vec<V1_4::SetupDataCallResult>& dcList) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->dataCallListChanged_1_4(type, dcList);
 }
 
 Return<void> RadioIndication::currentSignalStrength_1_4(
         V1_0::RadioIndicationType type, const V1_4::SignalStrength& signalStrength) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::INDICATION);
     return mRealRadioIndication->currentSignalStrength_1_4(type, signalStrength);
 }
 
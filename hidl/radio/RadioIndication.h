@@ -10,6 +10,10 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 
+#include "DispatchTracker.h"
+
+#include <memory>
+
 namespace android::hardware::radio::implementation {
 
 using ::android::sp;
@@ -22,6 +26,7 @@ using ::android::hardware::Void;
 
 struct RadioIndication : public V1_4::IRadioIndication {
     sp<V1_4::IRadioIndication> mRealRadioIndication;
+    std::shared_ptr<DispatchTracker> mDispatch;
     // Methods from ::android::hardware::radio::V1_0::IRadioIndication follow.
     Return<void> radioStateChanged(V1_0::RadioIndicationType type,
                                    V1_0::RadioState radioState) override;
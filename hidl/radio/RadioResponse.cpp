@@ -13,6 +13,8 @@ namespace android::hardware::radio::implementation {
 // Methods from ::android::hardware::radio::V1_0::IRadioResponse follow.
 Return<void> RadioResponse::getIccCardStatusResponse(const V1_0::RadioResponseInfo& info,
                                                      const V1_0::CardStatus& cardStatus) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     V1_4::CardStatus newCS = {};
     newCS.base.base = cardStatus;
     newCS.base.physicalSlotId = -1;
@@ -22,41 +24,57 @@ Return<void> RadioResponse::getIccCardStatusResponse(const V1_0::RadioResponseIn
 
 Return<void> RadioResponse::supplyIccPinForAppResponse(const V1_0::RadioResponseInfo& info,
                                                        int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->supplyIccPinForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::supplyIccPukForAppResponse(const V1_0::RadioResponseInfo& info,
                                                        int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->supplyIccPukForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::supplyIccPin2ForAppResponse(const V1_0::RadioResponseInfo& info,
                                                         int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->supplyIccPin2ForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::supplyIccPuk2ForAppResponse(const V1_0::RadioResponseInfo& info,
                                                         int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->supplyIccPuk2ForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::changeIccPinForAppResponse(const V1_0::RadioResponseInfo& info,
                                                        int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->changeIccPinForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::changeIccPin2ForAppResponse(const V1_0::RadioResponseInfo& info,
                                                         int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->changeIccPin2ForAppResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::supplyNetworkDepersonalizationResponse(
         const V1_0::RadioResponseInfo& info, int32_t remainingRetries) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->supplyNetworkDepersonalizationResponse(info, remainingRetries);
 }
 
 Return<void> RadioResponse::getCurrentCallsResponse(const V1_0::RadioResponseInfo& info,
                                                     const hidl_vec<V1_0::Call>& calls) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     hidl_vec<V1_2::Call> newCalls;
     newCalls.resize(calls.size());
 
@@ -68,47 +86,67 @@ Return<void> RadioResponse::getCurrentCallsResponse(const V1_0::RadioResponseInf
 }
 
 Return<void> RadioResponse::dialResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->dialResponse(info);
 }
 
 Return<void> RadioResponse::getIMSIForAppResponse(const V1_0::RadioResponseInfo& info,
                                                   const hidl_string& imsi) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getIMSIForAppResponse(info, imsi);
 }
 
 Return<void> RadioResponse::hangupConnectionResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->hangupConnectionResponse(info);
 }
 
 Return<void> RadioResponse::hangupWaitingOrBackgroundResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->hangupWaitingOrBackgroundResponse(info);
 }
 
 Return<void> RadioResponse::hangupForegroundResumeBackgroundResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->hangupForegroundResumeBackgroundResponse(info);
 }
 
 Return<void> RadioResponse::switchWaitingOrHoldingAndActiveResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->switchWaitingOrHoldingAndActiveResponse(info);
 }
 
 Return<void> RadioResponse::conferenceResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->conferenceResponse(info);
 }
 
 Return<void> RadioResponse::rejectCallResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->rejectCallResponse(info);
 }
 
 Return<void> RadioResponse::getLastCallFailCauseResponse(
         const V1_0::RadioResponseInfo& info, const V1_0::LastCallFailCauseInfo& failCauseinfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getLastCallFailCauseResponse(info, failCauseinfo);
 }
 
 Return<void> RadioResponse::getSignalStrengthResponse(const V1_0::RadioResponseInfo& info,
                                                       const V1_0::SignalStrength& sigStrength) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getSignalStrengthResponse_1_4(info, Create1_4SignalStrength(sigStrength));
 }
 
@@ -139,6 +177,8 @@ void Init1_2CellIdentity(const V1_0::CellIdentity& legacyCI, V1_2::CellIdentity&
 
 Return<void> RadioResponse::getVoiceRegistrationStateResponse(
         const V1_0::RadioResponseInfo& info, const V1_0::VoiceRegStateResult& voiceRegResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     V1_2::VoiceRegStateResult newVRR = {};
     newVRR.regState = voiceRegResponse.regState;
     newVRR.rat = voiceRegResponse.rat;
@@ -154,6 +194,8 @@ Return<void> RadioResponse::getVoiceRegistrationStateResponse(
 
 Return<void> RadioResponse::getDataRegistrationStateResponse(
         const V1_0::RadioResponseInfo& info, const V1_0::DataRegStateResult& dataRegResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     mDataRoaming = (dataRegResponse.regState == V1_0::RegState::REG_ROAMING);
     mRat = (V1_0::RadioTechnology) dataRegResponse.rat;
 
@@ -171,153 +213,219 @@ Return<void> RadioResponse::getOperatorResponse(const V1_0::RadioResponseInfo& i
                                                 const hidl_string& longName,
                                                 const hidl_string& shortName,
                                                 const hidl_string& numeric) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getOperatorResponse(info, longName, shortName, numeric);
 }
 
 Return<void> RadioResponse::setRadioPowerResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setRadioPowerResponse(info);
 }
 
 Return<void> RadioResponse::sendDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendDtmfResponse(info);
 }
 
 Return<void> RadioResponse::sendSmsResponse(const V1_0::RadioResponseInfo& info,
                                             const V1_0::SendSmsResult& sms) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendSmsResponse(info, sms);
 }
 
 Return<void> RadioResponse::sendSMSExpectMoreResponse(const V1_0::RadioResponseInfo& info,
                                                       const V1_0::SendSmsResult& sms) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendSMSExpectMoreResponse(info, sms);
 }
 
 Return<void> RadioResponse::setupDataCallResponse(const V1_0::RadioResponseInfo& info,
                                                   const V1_0::SetupDataCallResult& dcResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setupDataCallResponse_1_4(info, Create1_4SetupDataCallResult(dcResponse));
 }
 
 Return<void> RadioResponse::iccIOForAppResponse(const V1_0::RadioResponseInfo& info,
                                                 const V1_0::IccIoResult& iccIo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->iccIOForAppResponse(info, iccIo);
 }
 
 Return<void> RadioResponse::sendUssdResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendUssdResponse(info);
 }
 
 Return<void> RadioResponse::cancelPendingUssdResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->cancelPendingUssdResponse(info);
 }
 
 Return<void> RadioResponse::getClirResponse(const V1_0::RadioResponseInfo& info, int32_t n,
                                             int32_t m) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getClirResponse(info, n, m);
 }
 
 Return<void> RadioResponse::setClirResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setClirResponse(info);
 }
 
 Return<void> RadioResponse::getCallForwardStatusResponse(
         const V1_0::RadioResponseInfo& info,
         const hidl_vec<V1_0::CallForwardInfo>& callForwardInfos) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCallForwardStatusResponse(info, callForwardInfos);
 }
 
 Return<void> RadioResponse::setCallForwardResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCallForwardResponse(info);
 }
 
 Return<void> RadioResponse::getCallWaitingResponse(const V1_0::RadioResponseInfo& info, bool enable,
                                                    int32_t serviceClass) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCallWaitingResponse(info, enable, serviceClass);
 }
 
 Return<void> RadioResponse::setCallWaitingResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCallWaitingResponse(info);
 }
 
 Return<void> RadioResponse::acknowledgeLastIncomingGsmSmsResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->acknowledgeLastIncomingGsmSmsResponse(info);
 }
 
 Return<void> RadioResponse::acceptCallResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->acceptCallResponse(info);
 }
 
 Return<void> RadioResponse::deactivateDataCallResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->deactivateDataCallResponse(info);
 }
 
 Return<void> RadioResponse::getFacilityLockForAppResponse(const V1_0::RadioResponseInfo& info,
                                                           int32_t response) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getFacilityLockForAppResponse(info, response);
 }
 
 Return<void> RadioResponse::setFacilityLockForAppResponse(const V1_0::RadioResponseInfo& info,
                                                           int32_t retry) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setFacilityLockForAppResponse(info, retry);
 }
 
 Return<void> RadioResponse::setBarringPasswordResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setBarringPasswordResponse(info);
 }
 
 Return<void> RadioResponse::getNetworkSelectionModeResponse(const V1_0::RadioResponseInfo& info,
                                                             bool manual) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getNetworkSelectionModeResponse(info, manual);
 }
 
 Return<void> RadioResponse::setNetworkSelectionModeAutomaticResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setNetworkSelectionModeAutomaticResponse(info);
 }
 
 Return<void> RadioResponse::setNetworkSelectionModeManualResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setNetworkSelectionModeManualResponse(info);
 }
 
 Return<void> RadioResponse::getAvailableNetworksResponse(
         const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::OperatorInfo>& networkInfos) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getAvailableNetworksResponse(info, networkInfos);
 }
 
 Return<void> RadioResponse::startDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->startDtmfResponse(info);
 }
 
 Return<void> RadioResponse::stopDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->stopDtmfResponse(info);
 }
 
 Return<void> RadioResponse::getBasebandVersionResponse(const V1_0::RadioResponseInfo& info,
                                                        const hidl_string& version) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getBasebandVersionResponse(info, version);
 }
 
 Return<void> RadioResponse::separateConnectionResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->separateConnectionResponse(info);
 }
 
 Return<void> RadioResponse::setMuteResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setMuteResponse(info);
 }
 
 Return<void> RadioResponse::getMuteResponse(const V1_0::RadioResponseInfo& info, bool enable) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getMuteResponse(info, enable);
 }
 
 Return<void> RadioResponse::getClipResponse(const V1_0::RadioResponseInfo& info,
                                             V1_0::ClipStatus status) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getClipResponse(info, status);
 }
 
 Return<void> RadioResponse::getDataCallListResponse(
         const V1_0::RadioResponseInfo& info,
         const hidl_vec<V1_0::SetupDataCallResult>& dcResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     hidl_vec<V1_4::SetupDataCallResult> newResponse;
     newResponse.resize(dcResponse.size());
 
@@ -329,51 +437,73 @@ Return<void> RadioResponse::getDataCallListResponse(
 
 Return<void> RadioResponse::setSuppServiceNotificationsResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSuppServiceNotificationsResponse(info);
 }
 
 Return<void> RadioResponse::writeSmsToSimResponse(const V1_0::RadioResponseInfo& info,
                                                   int32_t index) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->writeSmsToSimResponse(info, index);
 }
 
 Return<void> RadioResponse::deleteSmsOnSimResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->deleteSmsOnSimResponse(info);
 }
 
 Return<void> RadioResponse::setBandModeResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setBandModeResponse(info);
 }
 
 Return<void> RadioResponse::getAvailableBandModesResponse(
         const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::RadioBandMode>& bandModes) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getAvailableBandModesResponse(info, bandModes);
 }
 
 Return<void> RadioResponse::sendEnvelopeResponse(const V1_0::RadioResponseInfo& info,
                                                  const hidl_string& commandResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendEnvelopeResponse(info, commandResponse);
 }
 
 Return<void> RadioResponse::sendTerminalResponseToSimResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendTerminalResponseToSimResponse(info);
 }
 
 Return<void> RadioResponse::handleStkCallSetupRequestFromSimResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->handleStkCallSetupRequestFromSimResponse(info);
 }
 
 Return<void> RadioResponse::explicitCallTransferResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->explicitCallTransferResponse(info);
 }
 
 Return<void> RadioResponse::setPreferredNetworkTypeResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setPreferredNetworkTypeBitmapResponse(info);
 }
 
 Return<void> RadioResponse::getPreferredNetworkTypeResponse(const V1_0::RadioResponseInfo& info,
                                                             V1_0::PreferredNetworkType nwType) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     hidl_bitfield<V1_4::RadioAccessFamily> nwTypeBitmap = 0;
     switch(nwType){
         case V1_0::PreferredNetworkType::GSM_WCDMA:
@@ -449,103 +579,147 @@ Return<void> RadioResponse::getPreferredNetworkTypeResponse(const V1_0::RadioRes
 
 Return<void> RadioResponse::getNeighboringCidsResponse(
         const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::NeighboringCell>& cells) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getNeighboringCidsResponse(info, cells);
 }
 
 Return<void> RadioResponse::setLocationUpdatesResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setLocationUpdatesResponse(info);
 }
 
 Return<void> RadioResponse::setCdmaSubscriptionSourceResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCdmaSubscriptionSourceResponse(info);
 }
 
 Return<void> RadioResponse::setCdmaRoamingPreferenceResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCdmaRoamingPreferenceResponse(info);
 }
 
 Return<void> RadioResponse::getCdmaRoamingPreferenceResponse(const V1_0::RadioResponseInfo& info,
                                                              V1_0::CdmaRoamingType type) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCdmaRoamingPreferenceResponse(info, type);
 }
 
 Return<void> RadioResponse::setTTYModeResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setTTYModeResponse(info);
 }
 
 Return<void> RadioResponse::getTTYModeResponse(const V1_0::RadioResponseInfo& info,
                                                V1_0::TtyMode mode) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getTTYModeResponse(info, mode);
 }
 
 Return<void> RadioResponse::setPreferredVoicePrivacyResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setPreferredVoicePrivacyResponse(info);
 }
 
 Return<void> RadioResponse::getPreferredVoicePrivacyResponse(const V1_0::RadioResponseInfo& info,
                                                              bool enable) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getPreferredVoicePrivacyResponse(info, enable);
 }
 
 Return<void> RadioResponse::sendCDMAFeatureCodeResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendCDMAFeatureCodeResponse(info);
 }
 
 Return<void> RadioResponse::sendBurstDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendBurstDtmfResponse(info);
 }
 
 Return<void> RadioResponse::sendCdmaSmsResponse(const V1_0::RadioResponseInfo& info,
                                                 const V1_0::SendSmsResult& sms) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendCdmaSmsResponse(info, sms);
 }
 
 Return<void> RadioResponse::acknowledgeLastIncomingCdmaSmsResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->acknowledgeLastIncomingCdmaSmsResponse(info);
 }
 
 Return<void> RadioResponse::getGsmBroadcastConfigResponse(
         const V1_0::RadioResponseInfo& info,
         const hidl_vec<V1_0::GsmBroadcastSmsConfigInfo>& configs) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getGsmBroadcastConfigResponse(info, configs);
 }
 
 Return<void> RadioResponse::setGsmBroadcastConfigResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setGsmBroadcastConfigResponse(info);
 }
 
 Return<void> RadioResponse::setGsmBroadcastActivationResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setGsmBroadcastActivationResponse(info);
 }
 
 Return<void> RadioResponse::getCdmaBroadcastConfigResponse(
         const V1_0::RadioResponseInfo& info,
         const hidl_vec<V1_0::CdmaBroadcastSmsConfigInfo>& configs) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCdmaBroadcastConfigResponse(info, configs);
 }
 
 Return<void> RadioResponse::setCdmaBroadcastConfigResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCdmaBroadcastConfigResponse(info);
 }
 
 Return<void> RadioResponse::setCdmaBroadcastActivationResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCdmaBroadcastActivationResponse(info);
 }
 
 Return<void> RadioResponse::getCDMASubscriptionResponse(
         const V1_0::RadioResponseInfo& info, const hidl_string& mdn, const hidl_string& hSid,
         const hidl_string& hNid, const hidl_string& min, const hidl_string& prl) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCDMASubscriptionResponse(info, mdn, hSid, hNid, min, prl);
 }
 
 Return<void> RadioResponse::writeSmsToRuimResponse(const V1_0::RadioResponseInfo& info,
                                                    uint32_t index) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->writeSmsToRuimResponse(info, index);
 }
 
 Return<void> RadioResponse::deleteSmsOnRuimResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->deleteSmsOnRuimResponse(info);
 }
 
@@ -554,180 +728,256 @@ Return<void> RadioResponse::getDeviceIdentityResponse(const V1_0::RadioResponseI
                                                       const hidl_string& imeisv,
                                                       const hidl_string& esn,
                                                       const hidl_string& meid) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getDeviceIdentityResponse(info, imei, imeisv, esn, meid);
 }
 
 Return<void> RadioResponse::exitEmergencyCallbackModeResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->exitEmergencyCallbackModeResponse(info);
 }
 
 Return<void> RadioResponse::getSmscAddressResponse(const V1_0::RadioResponseInfo& info,
                                                    const hidl_string& smsc) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getSmscAddressResponse(info, smsc);
 }
 
 Return<void> RadioResponse::setSmscAddressResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSmscAddressResponse(info);
 }
 
 Return<void> RadioResponse::reportSmsMemoryStatusResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->reportSmsMemoryStatusResponse(info);
 }
 
 Return<void> RadioResponse::reportStkServiceIsRunningResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->reportStkServiceIsRunningResponse(info);
 }
 
 Return<void> RadioResponse::getCdmaSubscriptionSourceResponse(const V1_0::RadioResponseInfo& info,
                                                               V1_0::CdmaSubscriptionSource source) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCdmaSubscriptionSourceResponse(info, source);
 }
 
 Return<void> RadioResponse::requestIsimAuthenticationResponse(const V1_0::RadioResponseInfo& info,
                                                               const hidl_string& response) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->requestIsimAuthenticationResponse(info, response);
 }
 
 Return<void> RadioResponse::acknowledgeIncomingGsmSmsWithPduResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->acknowledgeIncomingGsmSmsWithPduResponse(info);
 }
 
 Return<void> RadioResponse::sendEnvelopeWithStatusResponse(const V1_0::RadioResponseInfo& info,
                                                            const V1_0::IccIoResult& iccIo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendEnvelopeWithStatusResponse(info, iccIo);
 }
 
 Return<void> RadioResponse::getVoiceRadioTechnologyResponse(const V1_0::RadioResponseInfo& info,
                                                             V1_0::RadioTechnology rat) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getVoiceRadioTechnologyResponse(info, rat);
 }
 
 Return<void> RadioResponse::getCellInfoListResponse(const V1_0::RadioResponseInfo& info,
                                                     const hidl_vec<V1_0::CellInfo>& cellInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCellInfoListResponse_1_4(info, Create1_4CellInfoList(cellInfo));
 }
 
 Return<void> RadioResponse::setCellInfoListRateResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCellInfoListRateResponse(info);
 }
 
 Return<void> RadioResponse::setInitialAttachApnResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setInitialAttachApnResponse(info);
 }
 
 Return<void> RadioResponse::getImsRegistrationStateResponse(const V1_0::RadioResponseInfo& info,
                                                             bool isRegistered,
                                                             V1_0::RadioTechnologyFamily ratFamily) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getImsRegistrationStateResponse(info, isRegistered, ratFamily);
 }
 
 Return<void> RadioResponse::sendImsSmsResponse(const V1_0::RadioResponseInfo& info,
                                                const V1_0::SendSmsResult& sms) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendImsSmsResponse(info, sms);
 }
 
 Return<void> RadioResponse::iccTransmitApduBasicChannelResponse(const V1_0::RadioResponseInfo& info,
                                                                 const V1_0::IccIoResult& result) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->iccTransmitApduBasicChannelResponse(info, result);
 }
 
 Return<void> RadioResponse::iccOpenLogicalChannelResponse(const V1_0::RadioResponseInfo& info,
                                                           int32_t channelId,
                                                           const hidl_vec<int8_t>& selectResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->iccOpenLogicalChannelResponse(info, channelId, selectResponse);
 }
 
 Return<void> RadioResponse::iccCloseLogicalChannelResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->iccCloseLogicalChannelResponse(info);
 }
 
 Return<void> RadioResponse::iccTransmitApduLogicalChannelResponse(
         const V1_0::RadioResponseInfo& info, const V1_0::IccIoResult& result) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->iccTransmitApduLogicalChannelResponse(info, result);
 }
 
 Return<void> RadioResponse::nvReadItemResponse(const V1_0::RadioResponseInfo& info,
                                                const hidl_string& result) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->nvReadItemResponse(info, result);
 }
 
 Return<void> RadioResponse::nvWriteItemResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->nvWriteItemResponse(info);
 }
 
 Return<void> RadioResponse::nvWriteCdmaPrlResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->nvWriteCdmaPrlResponse(info);
 }
 
 Return<void> RadioResponse::nvResetConfigResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->nvResetConfigResponse(info);
 }
 
 Return<void> RadioResponse::setUiccSubscriptionResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setUiccSubscriptionResponse(info);
 }
 
 Return<void> RadioResponse::setDataAllowedResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setDataAllowedResponse(info);
 }
 
 Return<void> RadioResponse::getHardwareConfigResponse(
         const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::HardwareConfig>& config) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getHardwareConfigResponse(info, config);
 }
 
 Return<void> RadioResponse::requestIccSimAuthenticationResponse(const V1_0::RadioResponseInfo& info,
                                                                 const V1_0::IccIoResult& result) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->requestIccSimAuthenticationResponse(info, result);
 }
 
 Return<void> RadioResponse::setDataProfileResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setDataProfileResponse(info);
 }
 
 Return<void> RadioResponse::requestShutdownResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->requestShutdownResponse(info);
 }
 
 Return<void> RadioResponse::getRadioCapabilityResponse(const V1_0::RadioResponseInfo& info,
                                                        const V1_0::RadioCapability& rc) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getRadioCapabilityResponse(info, rc);
 }
 
 Return<void> RadioResponse::setRadioCapabilityResponse(const V1_0::RadioResponseInfo& info,
                                                        const V1_0::RadioCapability& rc) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setRadioCapabilityResponse(info, rc);
 }
 
 Return<void> RadioResponse::startLceServiceResponse(const V1_0::RadioResponseInfo& info,
                                                     const V1_0::LceStatusInfo& statusInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->startLceServiceResponse(info, statusInfo);
 }
 
 Return<void> RadioResponse::stopLceServiceResponse(const V1_0::RadioResponseInfo& info,
                                                    const V1_0::LceStatusInfo& statusInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->stopLceServiceResponse(info, statusInfo);
 }
 
 Return<void> RadioResponse::pullLceDataResponse(const V1_0::RadioResponseInfo& info,
                                                 const V1_0::LceDataInfo& lceInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->pullLceDataResponse(info, lceInfo);
 }
 
 Return<void> RadioResponse::getModemActivityInfoResponse(
         const V1_0::RadioResponseInfo& info, const V1_0::ActivityStatsInfo& activityInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getModemActivityInfoResponse(info, activityInfo);
 }
 
 Return<void> RadioResponse::setAllowedCarriersResponse(const V1_0::RadioResponseInfo& info,
                                                        int32_t /* numAllowed */) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setAllowedCarriersResponse_1_4(info);
 }
 
 Return<void> RadioResponse::getAllowedCarriersResponse(const V1_0::RadioResponseInfo& info,
                                                        bool allAllowed,
                                                        const V1_0::CarrierRestrictions& carriers) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     V1_4::CarrierRestrictionsWithPriority newCarriers = {};
     if(allAllowed){
         newCarriers.allowedCarriersPrioritized = false;
@@ -741,87 +991,122 @@ Return<void> RadioResponse::getAllowedCarriersResponse(const V1_0::RadioResponse
 }
 
 Return<void> RadioResponse::sendDeviceStateResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->sendDeviceStateResponse(info);
 }
 
 Return<void> RadioResponse::setIndicationFilterResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setIndicationFilterResponse(info);
 }
 
 Return<void> RadioResponse::setSimCardPowerResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSimCardPowerResponse_1_1(info);
 }
 
 Return<void> RadioResponse::acknowledgeRequest(int32_t serial) {
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->acknowledgeRequest(serial);
 }
 
 // Methods from ::android::hardware::radio::V1_1::IRadioResponse follow.
 Return<void> RadioResponse::setCarrierInfoForImsiEncryptionResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setCarrierInfoForImsiEncryptionResponse(info);
 }
 
 Return<void> RadioResponse::setSimCardPowerResponse_1_1(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSimCardPowerResponse_1_1(info);
 }
 
 Return<void> RadioResponse::startNetworkScanResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->startNetworkScanResponse_1_4(info);
 }
 
 
 Return<void> RadioResponse::stopNetworkScanResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->stopNetworkScanResponse(info);
 }
 
 Return<void> RadioResponse::startKeepaliveResponse(const V1_0::RadioResponseInfo& info,
                                                    const V1_1::KeepaliveStatus& status) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->startKeepaliveResponse(info, status);
 }
 
 Return<void> RadioResponse::stopKeepaliveResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->stopKeepaliveResponse(info);
 }
 
 // Methods from ::android::hardware::radio::V1_2::IRadioResponse follow.
 Return<void> RadioResponse::getCellInfoListResponse_1_2(const V1_0::RadioResponseInfo& info,
                                                         const hidl_vec<V1_2::CellInfo>& cellInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCellInfoListResponse_1_4(info, Create1_4CellInfoList(cellInfo));
 }
 
 Return<void> RadioResponse::getIccCardStatusResponse_1_2(const V1_0::RadioResponseInfo& info,
                                                          const V1_2::CardStatus& cardStatus) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getIccCardStatusResponse_1_4(info, {cardStatus, hidl_string("")});
 }
 
 Return<void> RadioResponse::setSignalStrengthReportingCriteriaResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSignalStrengthReportingCriteriaResponse(info);
 }
 
 Return<void> RadioResponse::setLinkCapacityReportingCriteriaResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setLinkCapacityReportingCriteriaResponse(info);
 }
 
 Return<void> RadioResponse::getCurrentCallsResponse_1_2(const V1_0::RadioResponseInfo& info,
                                                         const hidl_vec<V1_2::Call>& calls) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCurrentCallsResponse_1_2(info, calls);
 }
 
 Return<void> RadioResponse::getSignalStrengthResponse_1_2(
         const V1_0::RadioResponseInfo& info, const V1_2::SignalStrength& signalStrength) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getSignalStrengthResponse_1_4(info, Create1_4SignalStrength(signalStrength));
 }
 
 Return<void> RadioResponse::getVoiceRegistrationStateResponse_1_2(
         const V1_0::RadioResponseInfo& info, const V1_2::VoiceRegStateResult& voiceRegResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getVoiceRegistrationStateResponse_1_2(info, voiceRegResponse);
 }
 
 Return<void> RadioResponse::getDataRegistrationStateResponse_1_2(
         const V1_0::RadioResponseInfo& info, const V1_2::DataRegStateResult& dataRegResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     mDataRoaming = (dataRegResponse.regState == V1_0::RegState::REG_ROAMING);
     V1_4::DataRegStateResult newDRR = {};
     newDRR.base = dataRegResponse;
@@ -831,75 +1116,105 @@ Return<void> RadioResponse::getDataRegistrationStateResponse_1_2(
 // Methods from ::android::hardware::radio::V1_3::IRadioResponse follow.
 Return<void> RadioResponse::setSystemSelectionChannelsResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setSystemSelectionChannelsResponse(info);
 }
 
 Return<void> RadioResponse::enableModemResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->enableModemResponse(info);
 }
 
 Return<void> RadioResponse::getModemStackStatusResponse(const V1_0::RadioResponseInfo& info,
                                                         bool isEnabled) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getModemStackStatusResponse(info, isEnabled);
 }
 
 // Methods from ::android::hardware::radio::V1_4::IRadioResponse follow.
 Return<void> RadioResponse::emergencyDialResponse(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->emergencyDialResponse(info);
 }
 
 Return<void> RadioResponse::startNetworkScanResponse_1_4(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->startNetworkScanResponse_1_4(info);
 }
 
 Return<void> RadioResponse::getCellInfoListResponse_1_4(const V1_0::RadioResponseInfo& info,
                                                         const hidl_vec<V1_4::CellInfo>& cellInfo) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getCellInfoListResponse_1_4(info, cellInfo);
 }
 
 Return<void> RadioResponse::getDataRegistrationStateResponse_1_4(
         const V1_0::RadioResponseInfo& info, const V1_4::DataRegStateResult& dataRegResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getDataRegistrationStateResponse_1_4(info, dataRegResponse);
 }
 
 Return<void> RadioResponse::getIccCardStatusResponse_1_4(const V1_0::RadioResponseInfo& info,
                                                          const V1_4::CardStatus& cardStatus) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getIccCardStatusResponse_1_4(info, cardStatus);
 }
 
 Return<void> RadioResponse::getPreferredNetworkTypeBitmapResponse(
         const V1_0::RadioResponseInfo& info, hidl_bitfield<V1_4::RadioAccessFamily> networkTypeBitmap) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getPreferredNetworkTypeBitmapResponse(info, networkTypeBitmap);
 }
 
 Return<void> RadioResponse::setPreferredNetworkTypeBitmapResponse(
         const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setPreferredNetworkTypeBitmapResponse(info);
 }
 
 Return<void> RadioResponse::getDataCallListResponse_1_4(
         const V1_0::RadioResponseInfo& info,
         const hidl_vec<V1_4::SetupDataCallResult>& dcResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getDataCallListResponse_1_4(info, dcResponse);
 }
 
 Return<void> RadioResponse::setupDataCallResponse_1_4(const V1_0::RadioResponseInfo& info,
                                                       const V1_4::SetupDataCallResult& dcResponse) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setupDataCallResponse_1_4(info, dcResponse);
 }
 
 Return<void> RadioResponse::setAllowedCarriersResponse_1_4(const V1_0::RadioResponseInfo& info) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->setAllowedCarriersResponse_1_4(info);
 }
 
 Return<void> RadioResponse::getAllowedCarriersResponse_1_4(
         const V1_0::RadioResponseInfo& info, const V1_4::CarrierRestrictionsWithPriority& carriers,
         V1_4::SimLockMultiSimPolicy multiSimPolicy) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getAllowedCarriersResponse_1_4(info, carriers, multiSimPolicy);
 }
 
 Return<void> RadioResponse::getSignalStrengthResponse_1_4(
         const V1_0::RadioResponseInfo& info, const V1_4::SignalStrength& signalStrength) {
+    RequestTracer::ResponseScope trace(mTracer.get(), info.serial);
+    DispatchTracker::Scope dispatch(mDispatch.get(), DispatchTracker::RESPONSE);
     return mRealRadioResponse->getSignalStrengthResponse_1_4(info, signalStrength);
 }
 
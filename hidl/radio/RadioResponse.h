@@ -10,6 +10,11 @@
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
 
+#include "DispatchTracker.h"
+#include "RequestTracer.h"
+
+#include <memory>
+
 namespace android::hardware::radio::implementation {
 
 using ::android::sp;
@@ -22,6 +27,8 @@ using ::android::hardware::Void;
 
 struct RadioResponse : public V1_4::IRadioResponse {
     sp<V1_4::IRadioResponse> mRealRadioResponse;
+    std::shared_ptr<RequestTracer> mTracer;
+    std::shared_ptr<DispatchTracker> mDispatch;
     V1_0::RadioTechnology mRat = V1_0::RadioTechnology::UNKNOWN;
     bool mDataRoaming = false;
     // Methods from ::android::hardware::radio::V1_0::IRadioResponse follow.
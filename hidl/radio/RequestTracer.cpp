@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "RequestTracer.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+
+namespace android::hardware::radio::implementation {
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+RequestTracer::RequestScope::RequestScope(RequestTracer* tracer, int32_t serial,
+                                          const char* method)
+    : mTracer(tracer), mSerial(serial) {
+    mTracer->onRequestStart(serial, method);
+}
+
+RequestTracer::RequestScope::~RequestScope() {
+    if (mTracer != nullptr) {
+        mTracer->onRequestSent(mSerial);
+    }
+}
+
+RequestTracer::ResponseScope::ResponseScope(RequestTracer* tracer, int32_t serial)
+    : mTracer(tracer), mSerial(serial) {
+    if (mTracer != nullptr) {
+        mTracer->onResponseStart(serial);
+    }
+}
+
+RequestTracer::ResponseScope::~ResponseScope() {
+    if (mTracer != nullptr) {
+        mTracer->onResponseDone(mSerial);
+    }
+}
+
+RequestTracer::RequestTracer(int slotId) : mSlotId(slotId) {}
+
+void RequestTracer::Histogram::add(Clock::duration d) {
+    auto us = duration_cast<microseconds>(d).count();
+    auto it = std::upper_bound(kBucketLimitsUs.begin(), kBucketLimitsUs.end(), us);
+    buckets[it - kBucketLimitsUs.begin()]++;
+    count++;
+    total += d;
+    max = std::max(max, d);
+}
+
+RequestTracer::Clock::duration RequestTracer::Histogram::percentile(uint32_t pct) const {
+    uint64_t target = (count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketLimitsUs.size(); i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            return std::min<Clock::duration>(microseconds(kBucketLimitsUs[i]), max);
+        }
+    }
+    return max;
+}
+
+void RequestTracer::onRequestStart(int32_t serial, const char* method) {
+    auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mPending.size() >= kMaxPending && mPending.find(serial) == mPending.end()) {
+        auto oldest = std::min_element(mPending.begin(), mPending.end(),
+                                       [](const auto& a, const auto& b) {
+                                           return a.second.start < b.second.start;
+                                       });
+        mPending.erase(oldest);
+        mEvicted++;
+    }
+
+    // A wrapper may fall back to an older HAL version with the same serial; keep the
+    // first entry so the timestamp reflects the original Radio::* entry.
+    mPending.emplace(serial, Pending{method, now, {}, {}});
+}
+
+void RequestTracer::onRequestSent(int32_t serial) {
+    auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mPending.find(serial);
+    if (it != mPending.end() && it->second.sent == Clock::time_point()) {
+        it->second.sent = now;
+    }
+}
+
+void RequestTracer::onResponseStart(int32_t serial) {
+    auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mPending.find(serial);
+    if (it == mPending.end()) {
+        mUnmatched++;
+        return;
+    }
+
+    // The response of a oneway call may race with the return of the request itself.
+    if (it->second.sent == Clock::time_point()) {
+        it->second.sent = now;
+    }
+    it->second.responded = now;
+}
+
+void RequestTracer::onResponseDone(int32_t serial) {
+    auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mPending.find(serial);
+    if (it == mPending.end() || it->second.responded == Clock::time_point()) {
+        return;
+    }
+
+    const Pending& p = it->second;
+    MethodStats& stats = mStats[p.method];
+    stats.modem.add(p.responded - p.sent);
+    stats.shim.add((p.sent - p.start) + (now - p.responded));
+    mPending.erase(it);
+}
+
+void RequestTracer::dumpHistogram(int fd, const char* name, const Histogram& histogram) {
+    auto us = [](Clock::duration d) { return (long long)duration_cast<microseconds>(d).count(); };
+
+    dprintf(fd, "    %-5s avg=%lldus p50<=%lldus p90<=%lldus p99<=%lldus max=%lldus\n", name,
+            us(histogram.total) / (long long)std::max<uint64_t>(histogram.count, 1),
+            us(histogram.percentile(50)), us(histogram.percentile(90)),
+            us(histogram.percentile(99)), us(histogram.max));
+
+    dprintf(fd, "          ");
+    for (size_t i = 0; i < histogram.buckets.size(); i++) {
+        if (i < kBucketLimitsUs.size()) {
+            dprintf(fd, " <%uus:%llu", kBucketLimitsUs[i],
+                    (unsigned long long)histogram.buckets[i]);
+        } else {
+            dprintf(fd, " >=%uus:%llu", kBucketLimitsUs.back(),
+                    (unsigned long long)histogram.buckets[i]);
+        }
+    }
+    dprintf(fd, "\n");
+}
+
+void RequestTracer::dump(int fd, bool reset) {
+    std::lock_guard<std::mutex> lock(mLock);
+
+    dprintf(fd, "Radio slot %d request latency\n", mSlotId);
+    dprintf(fd, "  pending=%zu unmatched=%llu evicted=%llu\n", mPending.size(),
+            (unsigned long long)mUnmatched, (unsigned long long)mEvicted);
+
+    for (const auto& [method, stats] : mStats) {
+        dprintf(fd, "  %s count=%llu\n", method.c_str(), (unsigned long long)stats.modem.count);
+        dumpHistogram(fd, "modem", stats.modem);
+        dumpHistogram(fd, "shim", stats.shim);
+    }
+
+    if (reset) {
+        mStats.clear();
+        mUnmatched = 0;
+        mEvicted = 0;
+    }
+}
+
+}  // namespace android::hardware::radio::implementation
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace android::hardware::radio::implementation {
+
+/*
+ * Tracks every request forwarded by the shim from Radio::* entry to the matching
+ * RadioResponse::* / LgeRadioResponseV2::* callback, keyed by serial number.
+ *
+ * Two durations are kept per request: the time spent inside the shim (forwarding the
+ * request plus converting and forwarding the response) and the time the vendor RIL took
+ * to answer. Both are folded into per-method histograms that can be dumped through
+ * IBase::debug() (lshal debug android.hardware.radio@1.4::IRadio/slotN).
+ */
+class RequestTracer {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    class RequestScope {
+      public:
+        RequestScope() = default;
+        RequestScope(RequestTracer* tracer, int32_t serial, const char* method);
+        RequestScope(const RequestScope&) = delete;
+        RequestScope& operator=(const RequestScope&) = delete;
+        ~RequestScope();
+
+      private:
+        RequestTracer* mTracer = nullptr;
+        int32_t mSerial = 0;
+    };
+
+    class ResponseScope {
+      public:
+        ResponseScope(RequestTracer* tracer, int32_t serial);
+        ResponseScope(const ResponseScope&) = delete;
+        ResponseScope& operator=(const ResponseScope&) = delete;
+        ~ResponseScope();
+
+      private:
+        RequestTracer* mTracer;
+        int32_t mSerial;
+    };
+
+    explicit RequestTracer(int slotId);
+
+    // Only methods whose first argument is the request serial are tracked.
+    template <typename... Args>
+    RequestScope traceRequest(const char* method, int32_t serial, const Args&...) {
+        return RequestScope(this, serial, method);
+    }
+
+    template <typename... Args>
+    RequestScope traceRequest(const char* /* method */, const Args&...) {
+        return RequestScope();
+    }
+
+    void dump(int fd, bool reset);
+
+  private:
+    // Upper bounds of the latency buckets, in microseconds. The last bucket is open ended.
+    static constexpr std::array<uint32_t, 14> kBucketLimitsUs = {
+            100,    500,    1000,   2000,   5000,    10000,   20000,
+            50000,  100000, 200000, 500000, 1000000, 5000000, 10000000};
+    // Requests the vendor RIL never answers must not grow the pending table without bound.
+    static constexpr size_t kMaxPending = 256;
+
+    struct Histogram {
+        std::array<uint64_t, kBucketLimitsUs.size() + 1> buckets = {};
+        uint64_t count = 0;
+        Clock::duration total = Clock::duration::zero();
+        Clock::duration max = Clock::duration::zero();
+
+        void add(Clock::duration d);
+        Clock::duration percentile(uint32_t pct) const;
+    };
+
+    struct MethodStats {
+        Histogram modem;
+        Histogram shim;
+    };
+
+    struct Pending {
+        const char* method;
+        Clock::time_point start;
+        Clock::time_point sent;
+        Clock::time_point responded;
+    };
+
+    void onRequestStart(int32_t serial, const char* method);
+    void onRequestSent(int32_t serial);
+    void onResponseStart(int32_t serial);
+    void onResponseDone(int32_t serial);
+
+    static void dumpHistogram(int fd, const char* name, const Histogram& histogram);
+
+    const int mSlotId;
+
+    std::mutex mLock;
+    std::unordered_map<int32_t, Pending> mPending;
+    std::map<std::string, MethodStats> mStats;
+    uint64_t mUnmatched = 0;
+    uint64_t mEvicted = 0;
+};
+
+}  // namespace android::hardware::radio::implementation
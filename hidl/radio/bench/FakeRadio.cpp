@@ -0,0 +1,1112 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "FakeRadio.h"
+
+namespace android::hardware::radio::bench {
+
+bool FakeRadio::popRequest(Request* request) {
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mRequests.empty()) {
+        return false;
+    }
+
+    *request = std::move(mRequests.front());
+    mRequests.pop_front();
+    return true;
+}
+
+sp<V1_0::IRadioResponse> FakeRadio::getRadioResponse() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mRadioResponse;
+}
+
+sp<V1_0::IRadioIndication> FakeRadio::getRadioIndication() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mRadioIndication;
+}
+
+Return<void> FakeRadio::onRequest(const char* method, int32_t serial) {
+    std::lock_guard<std::mutex> lock(mLock);
+    mRequests.push_back({method, serial});
+    return Void();
+}
+
+// Methods from ::android::hardware::radio::V1_0::IRadio follow.
+Return<void> FakeRadio::setResponseFunctions(const sp<V1_0::IRadioResponse>& radioResponse,
+                                             const sp<V1_0::IRadioIndication>& radioIndication) {
+    std::lock_guard<std::mutex> lock(mLock);
+    mRadioResponse = radioResponse;
+    mRadioIndication = radioIndication;
+    return Void();
+}
+
+Return<void> FakeRadio::getIccCardStatus(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::supplyIccPinForApp(int32_t serial, const hidl_string& pin,
+                                           const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::supplyIccPukForApp(int32_t serial, const hidl_string& puk,
+                                           const hidl_string& pin, const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::supplyIccPin2ForApp(int32_t serial, const hidl_string& pin2,
+                                            const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::supplyIccPuk2ForApp(int32_t serial, const hidl_string& puk2,
+                                            const hidl_string& pin2, const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::changeIccPinForApp(int32_t serial, const hidl_string& oldPin,
+                                           const hidl_string& newPin, const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::changeIccPin2ForApp(int32_t serial, const hidl_string& oldPin2,
+                                            const hidl_string& newPin2, const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::supplyNetworkDepersonalization(int32_t serial, const hidl_string& netPin) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCurrentCalls(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::dial(int32_t serial, const V1_0::Dial& dialInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getImsiForApp(int32_t serial, const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::hangup(int32_t serial, int32_t gsmIndex) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::hangupWaitingOrBackground(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::hangupForegroundResumeBackground(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::switchWaitingOrHoldingAndActive(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::conference(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::rejectCall(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getLastCallFailCause(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getSignalStrength(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getVoiceRegistrationState(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getDataRegistrationState(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getOperator(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setRadioPower(int32_t serial, bool on) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendDtmf(int32_t serial, const hidl_string& s) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendSms(int32_t serial, const V1_0::GsmSmsMessage& message) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendSMSExpectMore(int32_t serial, const V1_0::GsmSmsMessage& message) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setupDataCall(int32_t serial, V1_0::RadioTechnology radioTechnology,
+                                      const V1_0::DataProfileInfo& dataProfileInfo,
+                                      bool modemCognitive, bool roamingAllowed, bool isRoaming) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::iccIOForApp(int32_t serial, const V1_0::IccIo& iccIo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendUssd(int32_t serial, const hidl_string& ussd) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::cancelPendingUssd(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getClir(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setClir(int32_t serial, int32_t status) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCallForwardStatus(int32_t serial,
+                                             const V1_0::CallForwardInfo& callInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCallForward(int32_t serial, const V1_0::CallForwardInfo& callInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCallWaiting(int32_t serial, int32_t serviceClass) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCallWaiting(int32_t serial, bool enable, int32_t serviceClass) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::acknowledgeLastIncomingGsmSms(int32_t serial, bool success,
+                                                      V1_0::SmsAcknowledgeFailCause cause) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::acceptCall(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::deactivateDataCall(int32_t serial, int32_t cid, bool reasonRadioShutDown) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getFacilityLockForApp(int32_t serial, const hidl_string& facility,
+                                              const hidl_string& password, int32_t serviceClass,
+                                              const hidl_string& appId) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setFacilityLockForApp(int32_t serial, const hidl_string& facility,
+                                              bool lockState, const hidl_string& password,
+                                              int32_t serviceClass, const hidl_string& appId) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setBarringPassword(int32_t serial, const hidl_string& facility,
+                                           const hidl_string& oldPassword,
+                                           const hidl_string& newPassword) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getNetworkSelectionMode(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setNetworkSelectionModeAutomatic(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setNetworkSelectionModeManual(int32_t serial,
+                                                      const hidl_string& operatorNumeric) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getAvailableNetworks(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::startDtmf(int32_t serial, const hidl_string& s) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::stopDtmf(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getBasebandVersion(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::separateConnection(int32_t serial, int32_t gsmIndex) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setMute(int32_t serial, bool enable) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getMute(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getClip(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getDataCallList(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setSuppServiceNotifications(int32_t serial, bool enable) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::writeSmsToSim(int32_t serial, const V1_0::SmsWriteArgs& smsWriteArgs) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::deleteSmsOnSim(int32_t serial, int32_t index) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setBandMode(int32_t serial, V1_0::RadioBandMode mode) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getAvailableBandModes(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendEnvelope(int32_t serial, const hidl_string& command) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendTerminalResponseToSim(int32_t serial,
+                                                  const hidl_string& commandResponse) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::handleStkCallSetupRequestFromSim(int32_t serial, bool accept) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::explicitCallTransfer(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setPreferredNetworkType(int32_t serial, V1_0::PreferredNetworkType nwType) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getPreferredNetworkType(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getNeighboringCids(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setLocationUpdates(int32_t serial, bool enable) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCdmaSubscriptionSource(int32_t serial,
+                                                  V1_0::CdmaSubscriptionSource cdmaSub) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCdmaRoamingPreference(int32_t serial, V1_0::CdmaRoamingType type) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCdmaRoamingPreference(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setTTYMode(int32_t serial, V1_0::TtyMode mode) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getTTYMode(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setPreferredVoicePrivacy(int32_t serial, bool enable) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getPreferredVoicePrivacy(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendCDMAFeatureCode(int32_t serial, const hidl_string& featureCode) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendBurstDtmf(int32_t serial, const hidl_string& dtmf, int32_t on,
+                                      int32_t off) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendCdmaSms(int32_t serial, const V1_0::CdmaSmsMessage& sms) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::acknowledgeLastIncomingCdmaSms(int32_t serial,
+                                                       const V1_0::CdmaSmsAck& smsAck) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getGsmBroadcastConfig(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setGsmBroadcastConfig(
+        int32_t serial, const hidl_vec<V1_0::GsmBroadcastSmsConfigInfo>& configInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setGsmBroadcastActivation(int32_t serial, bool activate) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCdmaBroadcastConfig(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCdmaBroadcastConfig(
+        int32_t serial, const hidl_vec<V1_0::CdmaBroadcastSmsConfigInfo>& configInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCdmaBroadcastActivation(int32_t serial, bool activate) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCDMASubscription(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::writeSmsToRuim(int32_t serial, const V1_0::CdmaSmsWriteArgs& cdmaSms) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::deleteSmsOnRuim(int32_t serial, int32_t index) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getDeviceIdentity(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::exitEmergencyCallbackMode(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getSmscAddress(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setSmscAddress(int32_t serial, const hidl_string& smsc) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::reportSmsMemoryStatus(int32_t serial, bool available) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::reportStkServiceIsRunning(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCdmaSubscriptionSource(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::requestIsimAuthentication(int32_t serial, const hidl_string& challenge) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::acknowledgeIncomingGsmSmsWithPdu(int32_t serial, bool success,
+                                                         const hidl_string& ackPdu) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendEnvelopeWithStatus(int32_t serial, const hidl_string& contents) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getVoiceRadioTechnology(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getCellInfoList(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setCellInfoListRate(int32_t serial, int32_t rate) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setInitialAttachApn(int32_t serial,
+                                            const V1_0::DataProfileInfo& dataProfileInfo,
+                                            bool modemCognitive, bool isRoaming) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getImsRegistrationState(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendImsSms(int32_t serial, const V1_0::ImsSmsMessage& message) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::iccTransmitApduBasicChannel(int32_t serial, const V1_0::SimApdu& message) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::iccOpenLogicalChannel(int32_t serial, const hidl_string& aid, int32_t p2) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::iccCloseLogicalChannel(int32_t serial, int32_t channelId) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::iccTransmitApduLogicalChannel(int32_t serial,
+                                                      const V1_0::SimApdu& message) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::nvReadItem(int32_t serial, V1_0::NvItem itemId) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::nvWriteItem(int32_t serial, const V1_0::NvWriteItem& item) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::nvWriteCdmaPrl(int32_t serial, const hidl_vec<uint8_t>& prl) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::nvResetConfig(int32_t serial, V1_0::ResetNvType resetType) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setUiccSubscription(int32_t serial, const V1_0::SelectUiccSub& uiccSub) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setDataAllowed(int32_t serial, bool allow) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getHardwareConfig(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::requestIccSimAuthentication(int32_t serial, int32_t authContext,
+                                                    const hidl_string& authData,
+                                                    const hidl_string& aid) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setDataProfile(int32_t serial,
+                                       const hidl_vec<V1_0::DataProfileInfo>& profiles,
+                                       bool isRoaming) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::requestShutdown(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getRadioCapability(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setRadioCapability(int32_t serial, const V1_0::RadioCapability& rc) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::startLceService(int32_t serial, int32_t reportInterval, bool pullMode) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::stopLceService(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::pullLceData(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getModemActivityInfo(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setAllowedCarriers(int32_t serial, bool allAllowed,
+                                           const V1_0::CarrierRestrictions& carriers) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getAllowedCarriers(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::sendDeviceState(int32_t serial, V1_0::DeviceStateType deviceStateType,
+                                        bool state) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setIndicationFilter(
+        int32_t serial, hidl_bitfield<V1_0::IndicationFilter> indicationFilter) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setSimCardPower(int32_t serial, bool powerUp) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::responseAcknowledgement() {
+    return Void();
+}
+
+// Methods from ::android::hardware::radio::V1_1::IRadio follow.
+Return<void> FakeRadio::setCarrierInfoForImsiEncryption(
+        int32_t serial, const V1_1::ImsiEncryptionInfo& imsiEncryptionInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setSimCardPower_1_1(int32_t serial, V1_1::CardPowerState powerUp) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::startNetworkScan(int32_t serial, const V1_1::NetworkScanRequest& request) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::stopNetworkScan(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::startKeepalive(int32_t serial, const V1_1::KeepaliveRequest& keepalive) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::stopKeepalive(int32_t serial, int32_t sessionHandle) {
+    return onRequest(__func__, serial);
+}
+
+// Methods from ::android::hardware::radio::V1_2::IRadio follow.
+Return<void> FakeRadio::startNetworkScan_1_2(int32_t serial,
+                                             const V1_2::NetworkScanRequest& request) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setIndicationFilter_1_2(
+        int32_t serial, hidl_bitfield<V1_2::IndicationFilter> indicationFilter) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setSignalStrengthReportingCriteria(int32_t serial, int32_t hysteresisMs,
+                                                           int32_t hysteresisDb,
+                                                           const hidl_vec<int32_t>& thresholdsDbm,
+                                                           V1_2::AccessNetwork accessNetwork) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setLinkCapacityReportingCriteria(
+        int32_t serial, int32_t hysteresisMs, int32_t hysteresisDlKbps, int32_t hysteresisUlKbps,
+        const hidl_vec<int32_t>& thresholdsDownlinkKbps,
+        const hidl_vec<int32_t>& thresholdsUplinkKbps, V1_2::AccessNetwork accessNetwork) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setupDataCall_1_2(int32_t serial, V1_2::AccessNetwork accessNetwork,
+                                          const V1_0::DataProfileInfo& dataProfileInfo,
+                                          bool modemCognitive, bool roamingAllowed, bool isRoaming,
+                                          V1_2::DataRequestReason reason,
+                                          const hidl_vec<hidl_string>& addresses,
+                                          const hidl_vec<hidl_string>& dnses) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::deactivateDataCall_1_2(int32_t serial, int32_t cid,
+                                               V1_2::DataRequestReason reason) {
+    return onRequest(__func__, serial);
+}
+
+// Methods from ::android::hardware::radio::V1_3::IRadio follow.
+Return<void> FakeRadio::setSystemSelectionChannels(
+        int32_t serial, bool specifyChannels,
+        const hidl_vec<V1_1::RadioAccessSpecifier>& specifiers) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::enableModem(int32_t serial, bool on) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getModemStackStatus(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+// Methods from ::android::hardware::radio::V1_4::IRadio follow.
+Return<void> FakeRadio::setupDataCall_1_4(int32_t serial, V1_4::AccessNetwork accessNetwork,
+                                          const V1_4::DataProfileInfo& dataProfileInfo,
+                                          bool roamingAllowed, V1_2::DataRequestReason reason,
+                                          const hidl_vec<hidl_string>& addresses,
+                                          const hidl_vec<hidl_string>& dnses) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setInitialAttachApn_1_4(int32_t serial,
+                                                const V1_4::DataProfileInfo& dataProfileInfo) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setDataProfile_1_4(int32_t serial,
+                                           const hidl_vec<V1_4::DataProfileInfo>& profiles) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::emergencyDial(int32_t serial, const V1_0::Dial& dialInfo,
+                                      hidl_bitfield<V1_4::EmergencyServiceCategory> categories,
+                                      const hidl_vec<hidl_string>& urns,
+                                      V1_4::EmergencyCallRouting routing,
+                                      bool hasKnownUserIntentEmergency, bool isTesting) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::startNetworkScan_1_4(int32_t serial,
+                                             const V1_2::NetworkScanRequest& request) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getPreferredNetworkTypeBitmap(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setPreferredNetworkTypeBitmap(
+        int32_t serial, hidl_bitfield<V1_4::RadioAccessFamily> networkTypeBitmap) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::setAllowedCarriers_1_4(
+        int32_t serial, const V1_4::CarrierRestrictionsWithPriority& carriers,
+        V1_4::SimLockMultiSimPolicy multiSimPolicy) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getAllowedCarriers_1_4(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+Return<void> FakeRadio::getSignalStrength_1_4(int32_t serial) {
+    return onRequest(__func__, serial);
+}
+
+sp<V2_0::ILgeRadioResponseV2> FakeLgeRadio::getLgeRadioResponse() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mLgeRadioResponse;
+}
+
+sp<V2_0::ILgeRadioIndicationV2> FakeLgeRadio::getLgeRadioIndication() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mLgeRadioIndication;
+}
+
+// Methods from ::vendor::lge::hardware::radio::V2_0::ILgeRadio follow.
+Return<void> FakeLgeRadio::setResponseFunctions(const sp<V2_0::ILgeRadioResponseV2>& response,
+                                                const sp<V2_0::ILgeRadioIndicationV2>& indication) {
+    std::lock_guard<std::mutex> lock(mLock);
+    mLgeRadioResponse = response;
+    mLgeRadioIndication = indication;
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setDatResponseFunctions(const sp<V2_0::ILgeDatResponse>& response) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::testLgeRadioInterface(int32_t serial, int32_t index) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::PBMReadRecord(int32_t serial, int32_t EFDevice, int32_t recIndex) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::PBMWriteRecord(int32_t serial, const V2_0::LgePbmRecords& records) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::PBMDeleteRecord(int32_t serial, int32_t EFDevice, int32_t recIndex) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::PBMGetInitState(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::PBMGetInfo(int32_t serial, int32_t EFDevice) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::UIMInternalRequestCmd(int32_t serial, const V2_0::LgeUimInternal& req) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::iccSetTransmitBehaviour(int32_t serial, int32_t channelNumber,
+                                                   bool expectDataWithWarningSW) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setCdmaEriVersion(int32_t serial, int32_t version) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setCdmaFactoryReset(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getMipErrorCode(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::cancelManualSearchingRequest(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setPreviousNetworkSelectionModeManual(
+        int32_t serial, const hidl_string& operatorNumeric, const hidl_string& operatorRat) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setRmnetAutoconnect(int32_t serial, int32_t param) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getSearchStatus(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getEngineeringModeInfo(int32_t serial, int32_t parameter) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setCSGSelectionManual(int32_t serial, int32_t data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getLteEmmErrorCode(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::loadVolteE911ScanList(int32_t serial, int32_t airplaneModeState,
+                                                 int32_t imsRegistrationState, int32_t emcType) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getVolteE911NetworkType(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::exitVolteE911EmergencyMode(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::sendE911CallState(int32_t serial, int32_t state) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setVoiceDomainPref(int32_t serial, int32_t mode) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setSrvccCallContextTransfer(
+        int32_t serial, const V2_0::LgeSrvccCallContextConfig& srvccCont) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setRssiTestAntConf(int32_t serial, int32_t antType) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getRssiTest(int32_t serial, int32_t sysMode) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setQcril(int32_t serial, int32_t cmdId) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setMiMoAntennaControlTest(int32_t serial, int32_t sys_mode,
+                                                     int32_t mask) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setModemInfo(int32_t serial, const V2_0::LgeIntString& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getModemInfo(int32_t serial, int32_t index, const hidl_string& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getGPRIItem(int32_t serial, int32_t parameter) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setGNOSInfo(int32_t serial, const V2_0::LgeIntString& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLteBandMode(int32_t serial, const hidl_vec<int64_t>& bandMode) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setEmergency(int32_t serial, int32_t state) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::vssModemReset(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaGetRFParameter(int32_t serial, int32_t kindOfData,
+                                              int32_t buffer_num) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaGetMisc(int32_t serial, const V2_0::LgeMocaGetMisc& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaSetLog(int32_t serial, const V2_0::LgeMocaConfigInfo& maskInfo) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaAlarmEvent(int32_t serial, const hidl_vec<int8_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaGetData(int32_t serial, int32_t buffer_num) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaSetMem(int32_t serial, int32_t kindOf, int32_t percent) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::mocaAlarmEventReg(int32_t serial, int32_t event) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::DMRequest(int32_t serial, const V2_0::LgeDmRequest& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setImsDataFlushEnabled(int32_t serial, int32_t enable) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::NSRI_SetCaptureMode_requestProc(int32_t serial, int32_t index,
+                                                           const hidl_vec<int8_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::NSRI_requestProc(int32_t serial, int32_t len_data,
+                                            const hidl_vec<int8_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::NSRI_Oem_requestProc(int32_t serial, int32_t index,
+                                                const hidl_vec<int8_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setNSRICallInfoTransfer(int32_t serial, int32_t callState,
+                                                   int32_t UEType, const hidl_string& phoneNumber) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::sendSarPowerState(int32_t serial, int32_t near) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setImsRegistrationStatus(int32_t serial, const hidl_vec<int32_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setImsCallStatus(int32_t serial, const hidl_vec<int32_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setScmMode(int32_t serial, int32_t type, int32_t mode,
+                                      int32_t emergency) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getIMSNetworkInfo(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::lgeGetSignalStrength(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::lgeGetCurrentCalls(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getAvailableNetworks(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getDataRegistrationState(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setPcasInfo(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLteProc(int32_t serial, int32_t type) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setOtasnPdnState(int32_t serial, int32_t state) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setImsCallStateForTuneAway(int32_t serial,
+                                                      const hidl_vec<int32_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setRfDatState(int32_t mode) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::sendCallDuration(int32_t serial, int32_t sec) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::requestWifiIccSimAuthentication(int32_t serial, int32_t authContext,
+                                                           const hidl_string& authData,
+                                                           const hidl_string& aid) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getWifiImsiForApp(int32_t serial, const hidl_string& aid) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getWifiIccCardStatus(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::sendLgeRequestRaw(int32_t serial, const hidl_vec<int8_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::sendLgeRequestStrings(int32_t serial,
+                                                 const hidl_vec<hidl_string>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getInitialAttachApn(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLge5GEnabled(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLge5GDisabled(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getLge5GStatus(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLgeEndcControl(int32_t serial, int32_t value) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::notifyImsCallState(int32_t serial, const hidl_vec<int32_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::changeCallPreference(int32_t serial, const hidl_vec<int32_t>& data) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setLteDataCallType(int32_t serial, const hidl_vec<int32_t>& data,
+                                              const hidl_string& name) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setTuneaway(int32_t serial, int32_t enable) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::goDormant(int32_t serial, const hidl_string& interfaceName) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::reportPdnThrottleInd(int32_t serial, bool enable) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setApnDisableFlag(int32_t serial, int32_t profileId,
+                                             const hidl_string& apn, bool isDisabled) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::setApnRoamingDisallowedFlag(int32_t serial, int32_t profileId,
+                                                       const hidl_string& apn,
+                                                       bool isRoamingDisabled) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::lgeSetNetworkSelectionModeManual(int32_t serial,
+                                                            const hidl_string& operatorNumeric,
+                                                            const hidl_string& operatorRat) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getDataRegistrationState_1_3(int32_t serial) {
+    return Void();
+}
+
+Return<void> FakeLgeRadio::getInitialAttachApn_1_3(int32_t serial) {
+    return Void();
+}
+
+}  // namespace android::hardware::radio::bench
@@ -0,0 +1,1061 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "FakeRadioClient.h"
+
+namespace android::hardware::radio::bench {
+
+// Methods from ::android::hardware::radio::V1_0::IRadioResponse follow.
+Return<void> FakeRadioResponse::getIccCardStatusResponse(const V1_0::RadioResponseInfo& info,
+                                                         const V1_0::CardStatus& cardStatus) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::supplyIccPinForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                           int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::supplyIccPukForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                           int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::supplyIccPin2ForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                            int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::supplyIccPuk2ForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                            int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::changeIccPinForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                           int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::changeIccPin2ForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                            int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::supplyNetworkDepersonalizationResponse(
+        const V1_0::RadioResponseInfo& info, int32_t remainingRetries) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCurrentCallsResponse(const V1_0::RadioResponseInfo& info,
+                                                        const hidl_vec<V1_0::Call>& calls) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::dialResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getIMSIForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                      const hidl_string& imsi) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::hangupConnectionResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::hangupWaitingOrBackgroundResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::hangupForegroundResumeBackgroundResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::switchWaitingOrHoldingAndActiveResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::conferenceResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::rejectCallResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getLastCallFailCauseResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::LastCallFailCauseInfo& failCauseinfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getSignalStrengthResponse(const V1_0::RadioResponseInfo& info,
+                                                          const V1_0::SignalStrength& sigStrength) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getVoiceRegistrationStateResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::VoiceRegStateResult& voiceRegResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDataRegistrationStateResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::DataRegStateResult& dataRegResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getOperatorResponse(const V1_0::RadioResponseInfo& info,
+                                                    const hidl_string& longName,
+                                                    const hidl_string& shortName,
+                                                    const hidl_string& numeric) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setRadioPowerResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendSmsResponse(const V1_0::RadioResponseInfo& info,
+                                                const V1_0::SendSmsResult& sms) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendSMSExpectMoreResponse(const V1_0::RadioResponseInfo& info,
+                                                          const V1_0::SendSmsResult& sms) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setupDataCallResponse(const V1_0::RadioResponseInfo& info,
+                                                      const V1_0::SetupDataCallResult& dcResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::iccIOForAppResponse(const V1_0::RadioResponseInfo& info,
+                                                    const V1_0::IccIoResult& iccIo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendUssdResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::cancelPendingUssdResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getClirResponse(const V1_0::RadioResponseInfo& info, int32_t n,
+                                                int32_t m) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setClirResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCallForwardStatusResponse(
+        const V1_0::RadioResponseInfo& info,
+        const hidl_vec<V1_0::CallForwardInfo>& callForwardInfos) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCallForwardResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCallWaitingResponse(const V1_0::RadioResponseInfo& info,
+                                                       bool enable, int32_t serviceClass) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCallWaitingResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::acknowledgeLastIncomingGsmSmsResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::acceptCallResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::deactivateDataCallResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getFacilityLockForAppResponse(
+        const V1_0::RadioResponseInfo& info, int32_t response) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setFacilityLockForAppResponse(
+        const V1_0::RadioResponseInfo& info, int32_t retry) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setBarringPasswordResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getNetworkSelectionModeResponse(
+        const V1_0::RadioResponseInfo& info, bool manual) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setNetworkSelectionModeAutomaticResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setNetworkSelectionModeManualResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getAvailableNetworksResponse(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::OperatorInfo>& networkInfos) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::startDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::stopDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getBasebandVersionResponse(const V1_0::RadioResponseInfo& info,
+                                                           const hidl_string& version) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::separateConnectionResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setMuteResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getMuteResponse(const V1_0::RadioResponseInfo& info, bool enable) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getClipResponse(const V1_0::RadioResponseInfo& info,
+                                                V1_0::ClipStatus status) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDataCallListResponse(
+        const V1_0::RadioResponseInfo& info,
+        const hidl_vec<V1_0::SetupDataCallResult>& dcResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setSuppServiceNotificationsResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::writeSmsToSimResponse(const V1_0::RadioResponseInfo& info,
+                                                      int32_t index) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::deleteSmsOnSimResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setBandModeResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getAvailableBandModesResponse(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::RadioBandMode>& bandModes) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendEnvelopeResponse(const V1_0::RadioResponseInfo& info,
+                                                     const hidl_string& commandResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendTerminalResponseToSimResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::handleStkCallSetupRequestFromSimResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::explicitCallTransferResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setPreferredNetworkTypeResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getPreferredNetworkTypeResponse(
+        const V1_0::RadioResponseInfo& info, V1_0::PreferredNetworkType nwType) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getNeighboringCidsResponse(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::NeighboringCell>& cells) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setLocationUpdatesResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCdmaSubscriptionSourceResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCdmaRoamingPreferenceResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCdmaRoamingPreferenceResponse(
+        const V1_0::RadioResponseInfo& info, V1_0::CdmaRoamingType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setTTYModeResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getTTYModeResponse(const V1_0::RadioResponseInfo& info,
+                                                   V1_0::TtyMode mode) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setPreferredVoicePrivacyResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getPreferredVoicePrivacyResponse(
+        const V1_0::RadioResponseInfo& info, bool enable) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendCDMAFeatureCodeResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendBurstDtmfResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendCdmaSmsResponse(const V1_0::RadioResponseInfo& info,
+                                                    const V1_0::SendSmsResult& sms) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::acknowledgeLastIncomingCdmaSmsResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getGsmBroadcastConfigResponse(
+        const V1_0::RadioResponseInfo& info,
+        const hidl_vec<V1_0::GsmBroadcastSmsConfigInfo>& configs) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setGsmBroadcastConfigResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setGsmBroadcastActivationResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCdmaBroadcastConfigResponse(
+        const V1_0::RadioResponseInfo& info,
+        const hidl_vec<V1_0::CdmaBroadcastSmsConfigInfo>& configs) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCdmaBroadcastConfigResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCdmaBroadcastActivationResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCDMASubscriptionResponse(const V1_0::RadioResponseInfo& info,
+                                                            const hidl_string& mdn,
+                                                            const hidl_string& hSid,
+                                                            const hidl_string& hNid,
+                                                            const hidl_string& min,
+                                                            const hidl_string& prl) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::writeSmsToRuimResponse(const V1_0::RadioResponseInfo& info,
+                                                       uint32_t index) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::deleteSmsOnRuimResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDeviceIdentityResponse(const V1_0::RadioResponseInfo& info,
+                                                          const hidl_string& imei,
+                                                          const hidl_string& imeisv,
+                                                          const hidl_string& esn,
+                                                          const hidl_string& meid) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::exitEmergencyCallbackModeResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getSmscAddressResponse(const V1_0::RadioResponseInfo& info,
+                                                       const hidl_string& smsc) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setSmscAddressResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::reportSmsMemoryStatusResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::reportStkServiceIsRunningResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCdmaSubscriptionSourceResponse(
+        const V1_0::RadioResponseInfo& info, V1_0::CdmaSubscriptionSource source) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::requestIsimAuthenticationResponse(
+        const V1_0::RadioResponseInfo& info, const hidl_string& response) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::acknowledgeIncomingGsmSmsWithPduResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendEnvelopeWithStatusResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::IccIoResult& iccIo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getVoiceRadioTechnologyResponse(
+        const V1_0::RadioResponseInfo& info, V1_0::RadioTechnology rat) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCellInfoListResponse(const V1_0::RadioResponseInfo& info,
+                                                        const hidl_vec<V1_0::CellInfo>& cellInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setCellInfoListRateResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setInitialAttachApnResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getImsRegistrationStateResponse(
+        const V1_0::RadioResponseInfo& info, bool isRegistered,
+        V1_0::RadioTechnologyFamily ratFamily) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendImsSmsResponse(const V1_0::RadioResponseInfo& info,
+                                                   const V1_0::SendSmsResult& sms) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::iccTransmitApduBasicChannelResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::IccIoResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::iccOpenLogicalChannelResponse(
+        const V1_0::RadioResponseInfo& info, int32_t channelId,
+        const hidl_vec<int8_t>& selectResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::iccCloseLogicalChannelResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::iccTransmitApduLogicalChannelResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::IccIoResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::nvReadItemResponse(const V1_0::RadioResponseInfo& info,
+                                                   const hidl_string& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::nvWriteItemResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::nvWriteCdmaPrlResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::nvResetConfigResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setUiccSubscriptionResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setDataAllowedResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getHardwareConfigResponse(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_0::HardwareConfig>& config) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::requestIccSimAuthenticationResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::IccIoResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setDataProfileResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::requestShutdownResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getRadioCapabilityResponse(const V1_0::RadioResponseInfo& info,
+                                                           const V1_0::RadioCapability& rc) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setRadioCapabilityResponse(const V1_0::RadioResponseInfo& info,
+                                                           const V1_0::RadioCapability& rc) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::startLceServiceResponse(const V1_0::RadioResponseInfo& info,
+                                                        const V1_0::LceStatusInfo& statusInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::stopLceServiceResponse(const V1_0::RadioResponseInfo& info,
+                                                       const V1_0::LceStatusInfo& statusInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::pullLceDataResponse(const V1_0::RadioResponseInfo& info,
+                                                    const V1_0::LceDataInfo& lceInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getModemActivityInfoResponse(
+        const V1_0::RadioResponseInfo& info, const V1_0::ActivityStatsInfo& activityInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setAllowedCarriersResponse(const V1_0::RadioResponseInfo& info,
+                                                           int32_t numAllowed) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getAllowedCarriersResponse(
+        const V1_0::RadioResponseInfo& info, bool allAllowed,
+        const V1_0::CarrierRestrictions& carriers) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::sendDeviceStateResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setIndicationFilterResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setSimCardPowerResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::acknowledgeRequest(int32_t serial) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_1::IRadioResponse follow.
+Return<void> FakeRadioResponse::setCarrierInfoForImsiEncryptionResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setSimCardPowerResponse_1_1(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::startNetworkScanResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::stopNetworkScanResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::startKeepaliveResponse(const V1_0::RadioResponseInfo& info,
+                                                       const V1_1::KeepaliveStatus& status) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::stopKeepaliveResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_2::IRadioResponse follow.
+Return<void> FakeRadioResponse::getCellInfoListResponse_1_2(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_2::CellInfo>& cellInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getIccCardStatusResponse_1_2(
+        const V1_0::RadioResponseInfo& info, const V1_2::CardStatus& cardStatus) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setSignalStrengthReportingCriteriaResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setLinkCapacityReportingCriteriaResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCurrentCallsResponse_1_2(const V1_0::RadioResponseInfo& info,
+                                                            const hidl_vec<V1_2::Call>& calls) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getSignalStrengthResponse_1_2(
+        const V1_0::RadioResponseInfo& info, const V1_2::SignalStrength& signalStrength) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getVoiceRegistrationStateResponse_1_2(
+        const V1_0::RadioResponseInfo& info, const V1_2::VoiceRegStateResult& voiceRegResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDataRegistrationStateResponse_1_2(
+        const V1_0::RadioResponseInfo& info, const V1_2::DataRegStateResult& dataRegResponse) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_3::IRadioResponse follow.
+Return<void> FakeRadioResponse::setSystemSelectionChannelsResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::enableModemResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getModemStackStatusResponse(const V1_0::RadioResponseInfo& info,
+                                                            bool isEnabled) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_4::IRadioResponse follow.
+Return<void> FakeRadioResponse::emergencyDialResponse(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::startNetworkScanResponse_1_4(const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getCellInfoListResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const hidl_vec<V1_4::CellInfo>& cellInfo) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDataRegistrationStateResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const V1_4::DataRegStateResult& dataRegResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getIccCardStatusResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const V1_4::CardStatus& cardStatus) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getPreferredNetworkTypeBitmapResponse(
+        const V1_0::RadioResponseInfo& info,
+        hidl_bitfield<V1_0::RadioAccessFamily> networkTypeBitmap) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setPreferredNetworkTypeBitmapResponse(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getDataCallListResponse_1_4(
+        const V1_0::RadioResponseInfo& info,
+        const hidl_vec<V1_4::SetupDataCallResult>& dcResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setupDataCallResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const V1_4::SetupDataCallResult& dcResponse) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::setAllowedCarriersResponse_1_4(
+        const V1_0::RadioResponseInfo& info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getAllowedCarriersResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const V1_4::CarrierRestrictionsWithPriority& carriers,
+        V1_4::SimLockMultiSimPolicy multiSimPolicy) {
+    return onCallback();
+}
+
+Return<void> FakeRadioResponse::getSignalStrengthResponse_1_4(
+        const V1_0::RadioResponseInfo& info, const V1_4::SignalStrength& signalStrength) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_0::IRadioIndication follow.
+Return<void> FakeRadioIndication::radioStateChanged(V1_0::RadioIndicationType type,
+                                                    V1_0::RadioState radioState) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::callStateChanged(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::networkStateChanged(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::newSms(V1_0::RadioIndicationType type,
+                                         const hidl_vec<uint8_t>& pdu) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::newSmsStatusReport(V1_0::RadioIndicationType type,
+                                                     const hidl_vec<uint8_t>& pdu) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::newSmsOnSim(V1_0::RadioIndicationType type,
+                                              int32_t recordNumber) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::onUssd(V1_0::RadioIndicationType type,
+                                         V1_0::UssdModeType modeType, const hidl_string& msg) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::nitzTimeReceived(V1_0::RadioIndicationType type,
+                                                   const hidl_string& nitzTime,
+                                                   uint64_t receivedTime) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentSignalStrength(
+        V1_0::RadioIndicationType type, const V1_0::SignalStrength& signalStrength) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::dataCallListChanged(
+        V1_0::RadioIndicationType type, const hidl_vec<V1_0::SetupDataCallResult>& dcList) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::suppSvcNotify(V1_0::RadioIndicationType type,
+                                                const V1_0::SuppSvcNotification& suppSvc) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::stkSessionEnd(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::stkProactiveCommand(V1_0::RadioIndicationType type,
+                                                      const hidl_string& cmd) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::stkEventNotify(V1_0::RadioIndicationType type,
+                                                 const hidl_string& cmd) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::stkCallSetup(V1_0::RadioIndicationType type, int64_t timeout) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::simSmsStorageFull(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::simRefresh(V1_0::RadioIndicationType type,
+                                             const V1_0::SimRefreshResult& refreshResult) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::callRing(V1_0::RadioIndicationType type, bool isGsm,
+                                           const V1_0::CdmaSignalInfoRecord& record) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::simStatusChanged(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaNewSms(V1_0::RadioIndicationType type,
+                                             const V1_0::CdmaSmsMessage& msg) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::newBroadcastSms(V1_0::RadioIndicationType type,
+                                                  const hidl_vec<uint8_t>& data) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaRuimSmsStorageFull(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::restrictedStateChanged(V1_0::RadioIndicationType type,
+                                                         V1_0::PhoneRestrictedState state) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::enterEmergencyCallbackMode(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaCallWaiting(V1_0::RadioIndicationType type,
+                                                  const V1_0::CdmaCallWaiting& callWaitingRecord) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaOtaProvisionStatus(V1_0::RadioIndicationType type,
+                                                         V1_0::CdmaOtaProvisionStatus status) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaInfoRec(V1_0::RadioIndicationType type,
+                                              const V1_0::CdmaInformationRecords& records) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::indicateRingbackTone(V1_0::RadioIndicationType type, bool start) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::resendIncallMute(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaSubscriptionSourceChanged(
+        V1_0::RadioIndicationType type, V1_0::CdmaSubscriptionSource cdmaSource) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cdmaPrlChanged(V1_0::RadioIndicationType type, int32_t version) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::exitEmergencyCallbackMode(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::rilConnected(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::voiceRadioTechChanged(V1_0::RadioIndicationType type,
+                                                        V1_0::RadioTechnology rat) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cellInfoList(V1_0::RadioIndicationType type,
+                                               const hidl_vec<V1_0::CellInfo>& records) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::imsNetworkStateChanged(V1_0::RadioIndicationType type) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::subscriptionStatusChanged(V1_0::RadioIndicationType type,
+                                                            bool activate) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::srvccStateNotify(V1_0::RadioIndicationType type,
+                                                   V1_0::SrvccState state) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::hardwareConfigChanged(
+        V1_0::RadioIndicationType type, const hidl_vec<V1_0::HardwareConfig>& configs) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::radioCapabilityIndication(V1_0::RadioIndicationType type,
+                                                            const V1_0::RadioCapability& rc) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::onSupplementaryServiceIndication(
+        V1_0::RadioIndicationType type, const V1_0::StkCcUnsolSsResult& ss) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::stkCallControlAlphaNotify(V1_0::RadioIndicationType type,
+                                                            const hidl_string& alpha) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::lceData(V1_0::RadioIndicationType type,
+                                          const V1_0::LceDataInfo& lce) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::pcoData(V1_0::RadioIndicationType type,
+                                          const V1_0::PcoDataInfo& pco) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::modemReset(V1_0::RadioIndicationType type,
+                                             const hidl_string& reason) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_1::IRadioIndication follow.
+Return<void> FakeRadioIndication::carrierInfoForImsiEncryption(V1_0::RadioIndicationType info) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::networkScanResult(V1_0::RadioIndicationType type,
+                                                    const V1_1::NetworkScanResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::keepaliveStatus(V1_0::RadioIndicationType type,
+                                                  const V1_1::KeepaliveStatus& status) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_2::IRadioIndication follow.
+Return<void> FakeRadioIndication::networkScanResult_1_2(V1_0::RadioIndicationType type,
+                                                        const V1_2::NetworkScanResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cellInfoList_1_2(V1_0::RadioIndicationType type,
+                                                   const hidl_vec<V1_2::CellInfo>& records) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentLinkCapacityEstimate(
+        V1_0::RadioIndicationType type, const V1_2::LinkCapacityEstimate& lce) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentPhysicalChannelConfigs(
+        V1_0::RadioIndicationType type, const hidl_vec<V1_2::PhysicalChannelConfig>& configs) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentSignalStrength_1_2(
+        V1_0::RadioIndicationType type, const V1_2::SignalStrength& signalStrength) {
+    return onCallback();
+}
+
+// Methods from ::android::hardware::radio::V1_4::IRadioIndication follow.
+Return<void> FakeRadioIndication::currentEmergencyNumberList(
+        V1_0::RadioIndicationType type,
+        const hidl_vec<V1_4::EmergencyNumber>& emergencyNumberList) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::cellInfoList_1_4(V1_0::RadioIndicationType type,
+                                                   const hidl_vec<V1_4::CellInfo>& records) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::networkScanResult_1_4(V1_0::RadioIndicationType type,
+                                                        const V1_4::NetworkScanResult& result) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentPhysicalChannelConfigs_1_4(
+        V1_0::RadioIndicationType type, const hidl_vec<V1_4::PhysicalChannelConfig>& configs) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::dataCallListChanged_1_4(
+        V1_0::RadioIndicationType type, const hidl_vec<V1_4::SetupDataCallResult>& dcList) {
+    return onCallback();
+}
+
+Return<void> FakeRadioIndication::currentSignalStrength_1_4(
+        V1_0::RadioIndicationType type, const V1_4::SignalStrength& signalStrength) {
+    return onCallback();
+}
+
+}  // namespace android::hardware::radio::bench
@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Replay.h"
+#include "../Helpers.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+namespace android::hardware::radio::bench {
+
+namespace {
+
+// Payload sizes roughly matching a dual-carrier LTE device in a dense area.
+constexpr size_t kCells = 8;
+constexpr size_t kDataCalls = 3;
+
+hidl_vec<V1_0::CellInfo> makeCellInfoList() {
+    hidl_vec<V1_0::CellInfo> cells;
+    cells.resize(kCells);
+    for (size_t i = 0; i < kCells; i++) {
+        cells[i].cellInfoType = V1_0::CellInfoType::LTE;
+        cells[i].registered = i == 0;
+        cells[i].lte.resize(1);
+        cells[i].lte[0].cellIdentityLte.pci = i;
+        cells[i].lte[0].signalStrengthLte.signalStrength = 20;
+    }
+    return cells;
+}
+
+hidl_vec<V1_2::CellInfo> makeCellInfoList_1_2() {
+    hidl_vec<V1_2::CellInfo> cells;
+    cells.resize(kCells);
+    for (size_t i = 0; i < kCells; i++) {
+        cells[i].cellInfoType = V1_0::CellInfoType::LTE;
+        cells[i].registered = i == 0;
+        cells[i].lte.resize(1);
+        cells[i].lte[0].cellIdentityLte.base.pci = i;
+        cells[i].lte[0].signalStrengthLte.signalStrength = 20;
+    }
+    return cells;
+}
+
+V1_0::SetupDataCallResult makeDataCall(int32_t cid) {
+    V1_0::SetupDataCallResult dc = {};
+    dc.cid = cid;
+    dc.active = 2;
+    dc.type = "IPV4V6";
+    dc.ifname = "rmnet_data" + std::to_string(cid);
+    dc.addresses = "10.0.0." + std::to_string(cid) + "/32 2001:db8::" + std::to_string(cid) +
+                   "/64";
+    dc.dnses = "8.8.8.8 2001:4860:4860::8888";
+    dc.gateways = "10.0.0.254 fe80::1";
+    dc.pcscf = "";
+    dc.mtu = 1500;
+    return dc;
+}
+
+hidl_vec<V1_0::SetupDataCallResult> makeDataCallList() {
+    hidl_vec<V1_0::SetupDataCallResult> dcs;
+    dcs.resize(kDataCalls);
+    for (size_t i = 0; i < kDataCalls; i++) {
+        dcs[i] = makeDataCall(i + 1);
+    }
+    return dcs;
+}
+
+using RequestFn = std::function<void(const sp<V1_4::IRadio>&, int32_t)>;
+using ResponseFn =
+        std::function<void(const sp<V1_4::IRadioResponse>&, const V1_0::RadioResponseInfo&)>;
+using IndicationFn = std::function<void(const sp<V1_4::IRadioIndication>&,
+                                        const sp<V2_0::ILgeRadioIndicationV2>&)>;
+
+#define SERIAL_ONLY_REQUEST(method) \
+    { #method, [](const sp<V1_4::IRadio>& radio, int32_t serial) { radio->method(serial); } }
+
+const std::map<std::string, RequestFn> kRequests = {
+        SERIAL_ONLY_REQUEST(getIccCardStatus),
+        SERIAL_ONLY_REQUEST(getCurrentCalls),
+        SERIAL_ONLY_REQUEST(getSignalStrength),
+        SERIAL_ONLY_REQUEST(getSignalStrength_1_4),
+        SERIAL_ONLY_REQUEST(getVoiceRegistrationState),
+        SERIAL_ONLY_REQUEST(getDataRegistrationState),
+        SERIAL_ONLY_REQUEST(getOperator),
+        SERIAL_ONLY_REQUEST(getCellInfoList),
+        SERIAL_ONLY_REQUEST(getDataCallList),
+        SERIAL_ONLY_REQUEST(getPreferredNetworkTypeBitmap),
+        {"setupDataCall_1_4",
+         [](const sp<V1_4::IRadio>& radio, int32_t serial) {
+             V1_4::DataProfileInfo profile = {};
+             profile.apn = "internet";
+             profile.protocol = V1_4::PdpProtocolType::IPV4V6;
+             profile.roamingProtocol = V1_4::PdpProtocolType::IPV4V6;
+             radio->setupDataCall_1_4(serial, V1_4::AccessNetwork::EUTRAN, profile, false,
+                                      V1_2::DataRequestReason::NORMAL, {}, {});
+         }},
+        {"deactivateDataCall_1_2",
+         [](const sp<V1_4::IRadio>& radio, int32_t serial) {
+             radio->deactivateDataCall_1_2(serial, 1, V1_2::DataRequestReason::NORMAL);
+         }},
+        {"setPreferredNetworkTypeBitmap",
+         [](const sp<V1_4::IRadio>& radio, int32_t serial) {
+             radio->setPreferredNetworkTypeBitmap(serial, LTEBITS | WCDMABITS | GSMBITS);
+         }},
+};
+
+#undef SERIAL_ONLY_REQUEST
+
+const std::map<std::string, ResponseFn> kResponses = {
+        {"getIccCardStatusResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             V1_0::CardStatus cardStatus = {};
+             cardStatus.cardState = V1_0::CardState::PRESENT;
+             cardStatus.applications.resize(2);
+             response->getIccCardStatusResponse(info, cardStatus);
+         }},
+        {"getCurrentCallsResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             hidl_vec<V1_0::Call> calls;
+             calls.resize(2);
+             response->getCurrentCallsResponse(info, calls);
+         }},
+        {"getSignalStrengthResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getSignalStrengthResponse(info, {});
+         }},
+        {"getSignalStrengthResponse_1_2",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getSignalStrengthResponse_1_2(info, {});
+         }},
+        {"getVoiceRegistrationStateResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getVoiceRegistrationStateResponse(info, {});
+         }},
+        {"getDataRegistrationStateResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getDataRegistrationStateResponse(info, {});
+         }},
+        {"getOperatorResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getOperatorResponse(info, "Operator", "Op", "00101");
+         }},
+        {"getCellInfoListResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getCellInfoListResponse(info, makeCellInfoList());
+         }},
+        {"getCellInfoListResponse_1_2",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getCellInfoListResponse_1_2(info, makeCellInfoList_1_2());
+         }},
+        {"getDataCallListResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getDataCallListResponse(info, makeDataCallList());
+         }},
+        {"setupDataCallResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->setupDataCallResponse(info, makeDataCall(1));
+         }},
+        {"deactivateDataCallResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->deactivateDataCallResponse(info);
+         }},
+        {"getPreferredNetworkTypeResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->getPreferredNetworkTypeResponse(
+                     info, V1_0::PreferredNetworkType::LTE_CMDA_EVDO_GSM_WCDMA);
+         }},
+        {"setPreferredNetworkTypeResponse",
+         [](const sp<V1_4::IRadioResponse>& response, const V1_0::RadioResponseInfo& info) {
+             response->setPreferredNetworkTypeResponse(info);
+         }},
+};
+
+const std::map<std::string, IndicationFn> kIndications = {
+        {"networkStateChanged",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->networkStateChanged(V1_0::RadioIndicationType::UNSOLICITED);
+         }},
+        {"currentSignalStrength",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->currentSignalStrength(V1_0::RadioIndicationType::UNSOLICITED, {});
+         }},
+        {"currentSignalStrength_1_2",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->currentSignalStrength_1_2(V1_0::RadioIndicationType::UNSOLICITED, {});
+         }},
+        {"cellInfoList",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->cellInfoList(V1_0::RadioIndicationType::UNSOLICITED,
+                                      makeCellInfoList());
+         }},
+        {"cellInfoList_1_2",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->cellInfoList_1_2(V1_0::RadioIndicationType::UNSOLICITED,
+                                          makeCellInfoList_1_2());
+         }},
+        {"dataCallListChanged",
+         [](const sp<V1_4::IRadioIndication>& indication,
+            const sp<V2_0::ILgeRadioIndicationV2>&) {
+             indication->dataCallListChanged(V1_0::RadioIndicationType::UNSOLICITED,
+                                             makeDataCallList());
+         }},
+        {"lgeCurrentSignalStrength",
+         [](const sp<V1_4::IRadioIndication>&,
+            const sp<V2_0::ILgeRadioIndicationV2>& lgeIndication) {
+             lgeIndication->lgeCurrentSignalStrength(V1_0::RadioIndicationType::UNSOLICITED, {});
+         }},
+};
+
+}  // anonymous namespace
+
+Replay::Replay() {
+    mRadio = new Radio(mFakeRadio, 1, mFakeLgeRadio);
+    mRadio->setResponseFunctions(mClientResponse, mClientIndication);
+}
+
+bool Replay::parse(std::istream& in, std::vector<Event>* events, std::string* error) {
+    std::string line;
+    for (int lineNo = 1; std::getline(in, line); lineNo++) {
+        std::istringstream fields(line);
+        std::string kind, name;
+        if (!(fields >> kind) || kind[0] == '#') {
+            continue;
+        }
+
+        fields >> name;
+        if (kind == "request" && kRequests.count(name)) {
+            events->push_back({REQUEST, name});
+        } else if (kind == "response" && kResponses.count(name)) {
+            events->push_back({RESPONSE, name});
+        } else if (kind == "indication" && kIndications.count(name)) {
+            events->push_back({INDICATION, name});
+        } else {
+            *error = "line " + std::to_string(lineNo) + ": unsupported event '" + line + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Replay::dispatch(const Event& event, std::string* error) {
+    switch (event.kind) {
+        case REQUEST:
+            kRequests.at(event.name)(mRadio, mNextSerial++);
+            return true;
+        case RESPONSE: {
+            FakeRadio::Request request;
+            if (!mFakeRadio->popRequest(&request)) {
+                *error = "response " + event.name + " without an outstanding request";
+                return false;
+            }
+
+            V1_0::RadioResponseInfo info = {};
+            info.type = V1_0::RadioResponseType::SOLICITED;
+            info.serial = request.serial;
+            info.error = V1_0::RadioError::NONE;
+            auto response = V1_4::IRadioResponse::castFrom(mFakeRadio->getRadioResponse())
+                                    .withDefault(nullptr);
+            kResponses.at(event.name)(response, info);
+            return true;
+        }
+        case INDICATION: {
+            auto indication = V1_4::IRadioIndication::castFrom(mFakeRadio->getRadioIndication())
+                                      .withDefault(nullptr);
+            kIndications.at(event.name)(indication, mFakeLgeRadio->getLgeRadioIndication());
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Replay::run(const std::vector<Event>& events, size_t iterations, std::string* error) {
+    auto start = Clock::now();
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (const auto& event : events) {
+            auto eventStart = Clock::now();
+            if (!dispatch(event, error)) {
+                return false;
+            }
+            auto elapsed = Clock::now() - eventStart;
+
+            Stats& stats = mStats[event.name];
+            stats.count++;
+            stats.total += elapsed;
+            stats.max = std::max(stats.max, elapsed);
+            mEvents++;
+        }
+    }
+
+    mElapsed += Clock::now() - start;
+    return true;
+}
+
+void Replay::dump(int fd) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    using std::chrono::nanoseconds;
+
+    auto ns = [](Clock::duration d) { return (long long)duration_cast<nanoseconds>(d).count(); };
+    long long elapsedUs = duration_cast<microseconds>(mElapsed).count();
+
+    dprintf(fd, "Replayed %llu events in %lldus (%.0f events/s)\n", (unsigned long long)mEvents,
+            elapsedUs, elapsedUs > 0 ? mEvents * 1e6 / elapsedUs : 0.0);
+    dprintf(fd, "Forwarded to client: %llu responses, %llu indications\n",
+            (unsigned long long)mClientResponse->getCallbackCount(),
+            (unsigned long long)mClientIndication->getCallbackCount());
+
+    for (const auto& [name, stats] : mStats) {
+        dprintf(fd, "  %-36s count=%-8llu avg=%lldns max=%lldns\n", name.c_str(),
+                (unsigned long long)stats.count, ns(stats.total) / (long long)stats.count,
+                ns(stats.max));
+    }
+
+    // The shim's own per-request view, as reported through lshal debug on a device.
+    native_handle_t* handle = native_handle_create(1, 0);
+    handle->data[0] = fd;
+    mRadio->debug(hidl_handle(handle), {});
+    native_handle_delete(handle);
+}
+
+}  // namespace android::hardware::radio::bench
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../Radio.h"
+#include "FakeRadio.h"
+#include "FakeRadioClient.h"
+
+namespace android::hardware::radio::bench {
+
+using ::android::hardware::radio::implementation::Radio;
+
+/*
+ * Replays a recorded request/response/indication trace through the shim against the fake
+ * vendor RIL and times every event. A trace is a text file with one event per line:
+ *
+ *     request getSignalStrength_1_4
+ *     response getSignalStrengthResponse
+ *     indication currentSignalStrength
+ *
+ * Responses answer the oldest request the fake RIL has not answered yet. Blank lines and
+ * lines starting with '#' are ignored.
+ */
+class Replay {
+  public:
+    enum Kind { REQUEST, RESPONSE, INDICATION };
+
+    struct Event {
+        Kind kind;
+        std::string name;
+    };
+
+    Replay();
+
+    static bool parse(std::istream& in, std::vector<Event>* events, std::string* error);
+
+    bool run(const std::vector<Event>& events, size_t iterations, std::string* error);
+    void dump(int fd);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        uint64_t count = 0;
+        Clock::duration total = Clock::duration::zero();
+        Clock::duration max = Clock::duration::zero();
+    };
+
+    bool dispatch(const Event& event, std::string* error);
+
+    sp<FakeRadio> mFakeRadio = new FakeRadio();
+    sp<FakeLgeRadio> mFakeLgeRadio = new FakeLgeRadio();
+    sp<FakeRadioResponse> mClientResponse = new FakeRadioResponse();
+    sp<FakeRadioIndication> mClientIndication = new FakeRadioIndication();
+    sp<Radio> mRadio;
+
+    int32_t mNextSerial = 1;
+    std::map<std::string, Stats> mStats;
+    Clock::duration mElapsed = Clock::duration::zero();
+    uint64_t mEvents = 0;
+};
+
+}  // namespace android::hardware::radio::bench
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define LOG_TAG "radio-shim-bench.lge"
+
+#include <android-base/logging.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "Replay.h"
+
+using android::hardware::radio::bench::Replay;
+
+// Used when no trace is given: a data call bring-up followed by the usual polling.
+static const char* kDefaultTrace = R"(
+request getDataRegistrationState
+response getDataRegistrationStateResponse
+request setupDataCall_1_4
+response setupDataCallResponse
+indication dataCallListChanged
+request getSignalStrength_1_4
+response getSignalStrengthResponse
+indication currentSignalStrength
+request getCellInfoList
+response getCellInfoListResponse
+indication cellInfoList
+indication lgeCurrentSignalStrength
+request getCurrentCalls
+response getCurrentCallsResponse
+)";
+
+static void usage(const char* name) {
+    fprintf(stderr, "usage: %s [-n iterations] [trace]\n", name);
+}
+
+int main(int argc, char** argv) {
+    size_t iterations = 1000;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                iterations = strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    std::vector<Replay::Event> events;
+    std::string error;
+    bool parsed;
+    if (optind < argc) {
+        std::ifstream trace(argv[optind]);
+        if (!trace) {
+            LOG(ERROR) << "Cannot open trace " << argv[optind];
+            return 1;
+        }
+        parsed = Replay::parse(trace, &events, &error);
+    } else {
+        std::istringstream trace(kDefaultTrace);
+        parsed = Replay::parse(trace, &events, &error);
+    }
+
+    if (!parsed) {
+        LOG(ERROR) << "Invalid trace: " << error;
+        return 1;
+    }
+
+    Replay replay;
+    if (!replay.run(events, iterations, &error)) {
+        LOG(ERROR) << "Replay failed: " << error;
+        return 1;
+    }
+
+    replay.dump(STDOUT_FILENO);
+    return 0;
+}
@@ -10,6 +10,7 @@
 #include <android-base/properties.h>
 #include <hidl/HidlTransportSupport.h>
 
+#include "DispatchTracker.h"
 #include "Radio.h"
 #include "hidl-utils.h"
 
@@ -22,6 +23,7 @@ using android::base::GetIntProperty;
 using android::hardware::configureRpcThreadpool;
 using android::hardware::joinRpcThreadpool;
 
+using android::hardware::radio::implementation::DispatchTracker;
 using android::hardware::radio::implementation::Radio;
 
 using android::OK;
@@ -50,7 +52,11 @@ int main() {
         linkDeathToDeath(realRadio);
     }
 
-    configureRpcThreadpool(MAX_SLOT_ID * 2 + 2, true);
+    // Size the pool from the slots that actually came up rather than the SIM count property.
+    // Indications hold at most two threads per slot, so two always stay free for requests.
+    size_t threads = DispatchTracker::threadsForSlots(slotIdToRadio.size());
+    DispatchTracker::setPoolSize(threads);
+    configureRpcThreadpool(threads, true);
 
     for (auto const& [slotId, radio] : slotIdToRadio) {
         status_t status = radio->registerAsService("slot" + std::to_string(slotId));
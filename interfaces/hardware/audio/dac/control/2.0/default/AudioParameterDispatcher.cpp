@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AudioParameterDispatcher.h"
+
+#include <android-base/logging.h>
+#include <android/hardware/audio/5.0/IDevicesFactory.h>
+#include <android/hardware/audio/6.0/IDevicesFactory.h>
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+using ::android::hardware::hidl_death_recipient;
+using ::android::hardware::hidl_vec;
+using ::android::hidl::base::V1_0::IBase;
+
+/* Time to wait for more parameters before sending a batch */
+static constexpr std::chrono::milliseconds BATCH_WINDOW(50);
+
+class AudioParameterDispatcher::DeathRecipient : public hidl_death_recipient {
+  public:
+    explicit DeathRecipient(AudioParameterDispatcher* dispatcher) : mDispatcher(dispatcher) {}
+
+    void serviceDied(uint64_t /* cookie */, const android::wp<IBase>& /* who */) override {
+        mDispatcher->onDeath();
+    }
+
+  private:
+    AudioParameterDispatcher* mDispatcher;
+};
+
+AudioParameterDispatcher::AudioParameterDispatcher()
+    : mDeathRecipient(new DeathRecipient(this)) {
+    mThread = std::thread(&AudioParameterDispatcher::threadLoop, this);
+}
+
+AudioParameterDispatcher::~AudioParameterDispatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQuit = true;
+    }
+    mCond.notify_one();
+    mThread.join();
+
+    std::lock_guard<std::mutex> lock(mDeviceLock);
+    if(mAudioDevice_V6_0 != nullptr) {
+        mAudioDevice_V6_0->unlinkToDeath(mDeathRecipient);
+    }
+    if(mAudioDevice_V5_0 != nullptr) {
+        mAudioDevice_V5_0->unlinkToDeath(mDeathRecipient);
+    }
+}
+
+bool AudioParameterDispatcher::connect() {
+    std::lock_guard<std::mutex> lock(mDeviceLock);
+    return connectLocked();
+}
+
+bool AudioParameterDispatcher::connectLocked() {
+    if(mAudioDevice_V6_0 != nullptr || mAudioDevice_V5_0 != nullptr) {
+        return true;
+    }
+
+    auto factory_V6_0 = ::android::hardware::audio::V6_0::IDevicesFactory::getService();
+    if(factory_V6_0 != nullptr) {
+        mVersion = AudioVersion::V6_0;
+        factory_V6_0->openDevice("primary",
+                [this](::android::hardware::audio::V6_0::Result result,
+                       const android::sp<::android::hardware::audio::V6_0::IDevice>& device) {
+                    if(result == ::android::hardware::audio::V6_0::Result::OK) {
+                        mAudioDevice_V6_0 = device;
+                    } else {
+                        LOG(INFO) << "Couldnt open primary audio device";
+                    }
+                });
+
+        if(mAudioDevice_V6_0 == nullptr) {
+            LOG(INFO) << "mAudioDevice_V6_0 null, aborting";
+            return false;
+        }
+        mAudioDevice_V6_0->linkToDeath(mDeathRecipient, 0);
+        return true;
+    }
+
+    LOG(INFO) << "mAudioDevicesFactory_V6_0 null, trying V5_0";
+    auto factory_V5_0 = ::android::hardware::audio::V5_0::IDevicesFactory::getService();
+    if(factory_V5_0 == nullptr) {
+        LOG(ERROR) << "mAudioDevicesFactory_V5_0 null, aborting";
+        return false;
+    }
+
+    mVersion = AudioVersion::V5_0;
+    factory_V5_0->openDevice("primary",
+            [this](::android::hardware::audio::V5_0::Result result,
+                   const android::sp<::android::hardware::audio::V5_0::IDevice>& device) {
+                if(result == ::android::hardware::audio::V5_0::Result::OK) {
+                    mAudioDevice_V5_0 = device;
+                } else {
+                    LOG(INFO) << "Couldnt open primary audio device";
+                }
+            });
+
+    if(mAudioDevice_V5_0 == nullptr) {
+        LOG(INFO) << "mAudioDevice_V5_0 null, aborting";
+        return false;
+    }
+    mAudioDevice_V5_0->linkToDeath(mDeathRecipient, 0);
+    return true;
+}
+
+void AudioParameterDispatcher::onDeath() {
+    LOG(ERROR) << "Audio HAL died, dropping the cached primary device";
+
+    std::lock_guard<std::mutex> lock(mDeviceLock);
+    mAudioDevice_V5_0 = nullptr;
+    mAudioDevice_V6_0 = nullptr;
+}
+
+bool AudioParameterDispatcher::setParametersLocked(
+        const std::map<std::string, std::string>& params) {
+    if(!connectLocked()) {
+        return false;
+    }
+
+    switch(mVersion) {
+        case AudioVersion::V6_0: {
+            hidl_vec<::android::hardware::audio::V6_0::ParameterValue> parameters(params.size());
+            size_t i = 0;
+            for(const auto& [key, value] : params) {
+                parameters[i++] = {key, value};
+            }
+            auto ret = mAudioDevice_V6_0->setParameters({}, parameters);
+            return ret.isOk() && ret == ::android::hardware::audio::V6_0::Result::OK;
+        }
+        case AudioVersion::V5_0: {
+            hidl_vec<::android::hardware::audio::V5_0::ParameterValue> parameters(params.size());
+            size_t i = 0;
+            for(const auto& [key, value] : params) {
+                parameters[i++] = {key, value};
+            }
+            auto ret = mAudioDevice_V5_0->setParameters({}, parameters);
+            return ret.isOk() && ret == ::android::hardware::audio::V5_0::Result::OK;
+        }
+        default:
+            return false;
+    }
+}
+
+bool AudioParameterDispatcher::flush() {
+    std::lock_guard<std::mutex> deviceLock(mDeviceLock);
+    std::map<std::string, std::string> params;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        params.swap(mPending);
+    }
+
+    if(params.empty()) {
+        return true;
+    }
+
+    bool ok = setParametersLocked(params);
+    if(!ok) {
+        LOG(ERROR) << "AudioParameterDispatcher: failed to set " << params.size() << " parameters";
+    }
+    return ok;
+}
+
+void AudioParameterDispatcher::post(const KeyValue& kv) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mPending[kv.name] = kv.value;
+    }
+    mCond.notify_one();
+}
+
+bool AudioParameterDispatcher::send(const KeyValue& kv) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mPending[kv.name] = kv.value;
+    }
+    return flush();
+}
+
+void AudioParameterDispatcher::threadLoop() {
+    std::unique_lock<std::mutex> lock(mLock);
+    for(;;) {
+        mCond.wait(lock, [this] { return !mPending.empty() || mQuit; });
+        if(!mQuit) {
+            // Let the rest of a burst land before sending
+            mCond.wait_for(lock, BATCH_WINDOW, [this] { return mQuit; });
+        }
+
+        lock.unlock();
+        flush();
+        lock.lock();
+
+        if(mQuit) {
+            return;
+        }
+    }
+}
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
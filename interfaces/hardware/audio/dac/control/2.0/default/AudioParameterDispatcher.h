@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vendor/lge/hardware/audio/dac/control/2.0/types.h>
+
+#include <android/hardware/audio/5.0/IDevice.h>
+#include <android/hardware/audio/6.0/IDevice.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+enum AudioVersion { V5_0, V6_0 };
+
+/*
+ * Sends DacControl's key/value pairs to the primary audio device.
+ *
+ * Every setParameters() call ends up in adev_set_parameters(), which parses the whole
+ * string and may re-route under the audio HAL's global lock. post() therefore only
+ * queues a pair; pairs posted within a short window are merged (the last value of a key
+ * wins) and sent as a single call from a worker thread. send() flushes whatever is
+ * pending together with its own pair and reports the result.
+ *
+ * The device proxy is opened once and cached. A death recipient drops it when the audio
+ * HAL dies, and it is reopened on the next call.
+ */
+class AudioParameterDispatcher {
+  public:
+    AudioParameterDispatcher();
+    ~AudioParameterDispatcher();
+
+    bool connect();
+    void post(const KeyValue& kv);
+    bool send(const KeyValue& kv);
+
+  private:
+    class DeathRecipient;
+
+    bool connectLocked();
+    bool flush();
+    bool setParametersLocked(const std::map<std::string, std::string>& params);
+    void onDeath();
+    void threadLoop();
+
+    // Serialises calls into the audio HAL and guards the device proxies.
+    std::mutex mDeviceLock;
+    AudioVersion mVersion = AudioVersion::V6_0;
+    android::sp<::android::hardware::audio::V5_0::IDevice> mAudioDevice_V5_0;
+    android::sp<::android::hardware::audio::V6_0::IDevice> mAudioDevice_V6_0;
+    android::sp<DeathRecipient> mDeathRecipient;
+
+    // Guards the pending parameters; never held across a HIDL call.
+    std::mutex mLock;
+    std::condition_variable mCond;
+    std::map<std::string, std::string> mPending;
+    bool mQuit = false;
+    std::thread mThread;
+};
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
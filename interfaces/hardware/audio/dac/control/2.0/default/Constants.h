@@ -42,8 +42,10 @@
 #define PROPERTY_HIFI_DAC_MODE             "persist.vendor.audio.ess.mode"
 #define PROPERTY_HIFI_DAC_AVC_VOLUME       "persist.vendor.audio.ess.avc_volume"
 
+#define PROPERTY_CUSTOM_FILTER             "persist.vendor.audio.ess.customFilter"
 #define PROPERTY_CUSTOM_FILTER_SHAPE       "persist.vendor.audio.ess.customFilterShape"
 #define PROPERTY_CUSTOM_FILTER_SYMMETRY    "persist.vendor.audio.ess.customFilterSymmetry"
+#define CUSTOM_FILTER_COEFFS_COUNT         14
 extern std::vector<std::string> PROPERTY_CUSTOM_FILTER_COEFFS;
 
 #ifndef PROPRIETARY_AUDIO_MODULE
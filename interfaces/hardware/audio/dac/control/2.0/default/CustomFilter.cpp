@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CustomFilter.h"
+
+#include <android-base/parseint.h>
+#include <android-base/strings.h>
+
+#include <vector>
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+std::string CustomFilter::encode() const {
+    std::string filter_data;
+
+    /*
+    * Let's build the actual string with the custom filter's shape, symmetry and 14 Stage 2 coefficients
+    *
+    */
+    filter_data.reserve(16 * 12);
+    filter_data.append(std::to_string(shape)).append(",");
+    filter_data.append(std::to_string(symmetry));
+    for (int32_t coeff : coeffs) {
+        filter_data.append(",").append(std::to_string(coeff));
+    }
+
+    return filter_data;
+}
+
+bool CustomFilter::decode(const std::string& data, CustomFilter* filter) {
+    std::vector<std::string> fields = android::base::Split(data, ",");
+    CustomFilter result;
+
+    if(fields.size() != 2 + CUSTOM_FILTER_COEFFS_COUNT) {
+        return false;
+    }
+
+    if(!android::base::ParseInt(fields[0], &result.shape) ||
+       !android::base::ParseInt(fields[1], &result.symmetry)) {
+        return false;
+    }
+    for (int i = 0; i < CUSTOM_FILTER_COEFFS_COUNT; i++) {
+        if(!android::base::ParseInt(fields[2 + i], &result.coeffs[i])) {
+            return false;
+        }
+    }
+
+    *filter = result;
+    return true;
+}
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
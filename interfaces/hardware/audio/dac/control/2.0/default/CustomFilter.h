@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "Constants.h"
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+/*
+ * Shape, symmetry and Stage 2 coefficients of the ES9218 custom filter.
+ *
+ * encode() produces the string the ess_custom_filter node expects, which is also
+ * what gets persisted, so the whole filter round-trips through a single value.
+ */
+struct CustomFilter {
+    int32_t shape = 0;
+    int32_t symmetry = 0;
+    std::array<int32_t, CUSTOM_FILTER_COEFFS_COUNT> coeffs = {};
+
+    std::string encode() const;
+    static bool decode(const std::string& data, CustomFilter* filter);
+
+    bool operator==(const CustomFilter& other) const {
+        return shape == other.shape && symmetry == other.symmetry && coeffs == other.coeffs;
+    }
+    bool operator!=(const CustomFilter& other) const { return !(*this == other); }
+};
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DacCapabilities.h"
+
+#include <sys/stat.h>
+
+#include <vector>
+
+#include "Constants.h"
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+static constexpr int32_t MAX_BALANCE_VALUE = 0;
+static constexpr int32_t MIN_BALANCE_VALUE = -12;
+
+static constexpr int32_t MAX_AVC_VOLUME_VALUE = 0;
+static constexpr int32_t MIN_AVC_VOLUME_VALUE = -24;
+
+static std::vector<KeyValue> sound_presets = {{"Normal", "0"},
+                                              {"Enhanced", "1"},
+                                              {"Detailed", "2"},
+                                              {"Live", "3"},
+                                              {"Bass", "4"}};
+
+static std::vector<KeyValue> digital_filters = {{"Short", "0"},
+                                                {"Sharp", "1"},
+                                                {"Slow", "2"}};
+
+static std::vector<KeyValue> hifi_modes = {{"Normal", "0"},
+                                           {"High Impedance", "1"},
+                                           {"AUX High Impedance", "2"}};
+
+static FeatureStates makeStates(const std::vector<KeyValue>& states) {
+    FeatureStates fstates;
+    fstates.states = hidl_vec<KeyValue> {states};
+    return fstates;
+}
+
+static FeatureStates makeRange(int32_t min, int32_t max) {
+    FeatureStates fstates;
+    fstates.range.min = min;
+    fstates.range.max = max;
+    fstates.range.step = 1;
+    return fstates;
+}
+
+BackendDacProbe::BackendDacProbe() {
+    dac_init(&mDac);
+}
+
+bool BackendDacProbe::hasNode(const std::string& node) {
+    struct stat buffer;
+
+    if(node.empty()) {
+        return dac_hifi_supported(&mDac);
+    }
+
+    // A simulated DAC has no driver nodes
+    if(!mDac.backend->routes_audio) {
+        return false;
+    }
+    return stat((COMMON_ES9218_PATH + node).c_str(), &buffer) == 0;
+}
+
+bool BackendDacProbe::hasSoundPresets() {
+#ifdef PROPRIETARY_AUDIO_MODULE
+    return true;
+#else
+    return false;
+#endif
+}
+
+DacCapabilities::DacCapabilities(DacProbe& probe) {
+    if(!probe.hasNode("")) {
+        return;
+    }
+
+    /* Quad DAC */
+    addFeature(Feature::QuadDAC);
+
+    /* Digital Filter */
+    if(probe.hasNode(ESS_FILTER)) {
+        addFeature(Feature::DigitalFilter, makeStates(digital_filters));
+    }
+
+    /* Sound Presets */
+    if(probe.hasSoundPresets()) {
+        addFeature(Feature::SoundPreset, makeStates(sound_presets));
+    }
+
+    /* Balance Left */
+    if(probe.hasNode(VOLUME_LEFT)) {
+        addFeature(Feature::BalanceLeft, makeRange(MIN_BALANCE_VALUE, MAX_BALANCE_VALUE));
+    }
+
+    /* Balance Right */
+    if(probe.hasNode(VOLUME_RIGHT)) {
+        addFeature(Feature::BalanceRight, makeRange(MIN_BALANCE_VALUE, MAX_BALANCE_VALUE));
+    }
+
+    /* AVC Volume */
+    if(probe.hasNode(AVC_VOLUME)) {
+        addFeature(Feature::AVCVolume, makeRange(MIN_AVC_VOLUME_VALUE, MAX_AVC_VOLUME_VALUE));
+    }
+
+    /* Hi-Fi Mode setting */
+    if(probe.hasNode(HIFI_MODE)) {
+        addFeature(Feature::HifiMode, makeStates(hifi_modes));
+    }
+
+    /* Custom ESS filter setting */
+    if(probe.hasNode(ESS_CUSTOM_FILTER)) {
+        addFeature(Feature::CustomFilter);
+    }
+}
+
+void DacCapabilities::addFeature(Feature feature) {
+    mCapabilities[static_cast<size_t>(feature)].supported = true;
+
+    size_t count = mSupportedFeatures.size();
+    mSupportedFeatures.resize(count + 1);
+    mSupportedFeatures[count] = feature;
+}
+
+void DacCapabilities::addFeature(Feature feature, const FeatureStates& states) {
+    Capability& cap = mCapabilities[static_cast<size_t>(feature)];
+    cap.hasStates = true;
+    cap.states = states;
+    addFeature(feature);
+}
+
+bool DacCapabilities::isSupported(Feature feature) const {
+    size_t index = static_cast<size_t>(feature);
+    return index < FEATURE_COUNT && mCapabilities[index].supported;
+}
+
+const FeatureStates* DacCapabilities::getStates(Feature feature) const {
+    if(!isSupported(feature) || !mCapabilities[static_cast<size_t>(feature)].hasStates) {
+        return nullptr;
+    }
+    return &mCapabilities[static_cast<size_t>(feature)].states;
+}
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vendor/lge/hardware/audio/dac/control/2.0/types.h>
+
+#include <dac_backend.h>
+
+#include <array>
+#include <string>
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+using ::android::hardware::hidl_vec;
+
+/*
+ * What the capability table asks of the device, so that it can be built against a fake.
+ */
+class DacProbe {
+  public:
+    virtual ~DacProbe() = default;
+
+    // Whether a node of the DAC driver exists, an empty name asks for the driver itself.
+    virtual bool hasNode(const std::string& node) = 0;
+    // Whether the audio HAL takes sound preset commands.
+    virtual bool hasSoundPresets() = 0;
+};
+
+// Asks the DAC backend shared with the audio HAL, and the es9218 driver for its nodes.
+class BackendDacProbe : public DacProbe {
+  public:
+    BackendDacProbe();
+
+    bool hasNode(const std::string& node) override;
+    bool hasSoundPresets() override;
+
+  private:
+    dac_state_t mDac;
+};
+
+/*
+ * What the detected DAC supports for each feature, worked out once from a probe.
+ * Indexed by Feature so lookups on the (chatty) HIDL interface are O(1).
+ */
+class DacCapabilities {
+  public:
+    DacCapabilities() = default;
+    explicit DacCapabilities(DacProbe& probe);
+
+    // Out of range values coming in over HIDL are reported as unsupported.
+    bool isSupported(Feature feature) const;
+    // The states or range of a supported feature, nullptr if it has none.
+    const FeatureStates* getStates(Feature feature) const;
+    const hidl_vec<Feature>& getSupportedFeatures() const { return mSupportedFeatures; }
+
+  private:
+    static constexpr size_t FEATURE_COUNT = static_cast<size_t>(Feature::CustomFilter) + 1;
+
+    struct Capability {
+        bool supported = false;
+        bool hasStates = false;
+        FeatureStates states;
+    };
+
+    void addFeature(Feature feature);
+    void addFeature(Feature feature, const FeatureStates& states);
+
+    std::array<Capability, FEATURE_COUNT> mCapabilities;
+    hidl_vec<Feature> mSupportedFeatures;
+};
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
@@ -21,8 +21,6 @@
 #include <cutils/properties.h>
 
 #include <fstream>
-#include <sys/stat.h>
-#include <unistd.h>
 
 std::vector<std::string> PROPERTY_CUSTOM_FILTER_COEFFS = {
     "persist.vendor.audio.ess.customFilterCoeff0", "persist.vendor.audio.ess.customFilterCoeff1",
@@ -41,40 +39,39 @@ namespace control {
 namespace V2_0 {
 namespace implementation {
 
-static constexpr int32_t MAX_BALANCE_VALUE = 0;
-static constexpr int32_t MIN_BALANCE_VALUE = -12;
-
-static std::vector<KeyValue> sound_presets = {{"Normal", "0"},
-                                              {"Enhanced", "1"},
-                                              {"Detailed", "2"},
-                                              {"Live", "3"},
-                                              {"Bass", "4"}};
-
-static std::vector<KeyValue> digital_filters = {{"Short", "0"},
-                                                {"Sharp", "1"},
-                                                {"Slow", "2"}};
-
-static std::vector<KeyValue> hifi_modes = {{"Normal", "0"},
-                                           {"High Impedance", "1"},
-                                           {"AUX High Impedance", "2"}};
-
 /*
- * Write value to path and close file.
+ * Write value to path and close file, unless the node already holds it.
  */
-template <typename T>
-static void set(const std::string& path, const T& value) {
+void DacControl::writeNode(const std::string& path, const std::string& value) {
+    auto it = mNodeValues.find(path);
+    if(it != mNodeValues.end() && it->second == value) {
+        return;
+    }
+
     std::ofstream file(path);
     file << value;
+    file.close();
+    if(file.fail()) {
+        LOG(ERROR) << "DacControl::writeNode: failed to write " << value << " to " << path;
+        mNodeValues.erase(path);
+        return;
+    }
+    mNodeValues[path] = value;
 }
 
-DacControl::DacControl() {
-    if(access(COMMON_ES9218_PATH, F_OK) != 0) {
+void DacControl::writeNode(const std::string& path, int32_t value) {
+    writeNode(path, std::to_string(value));
+}
+
+DacControl::DacControl(std::unique_ptr<DacProbe> probe) {
+    dac_init(&mDac);
+
+    DacCapabilities capabilities(*probe);
+    if(!capabilities.isSupported(Feature::QuadDAC)) {
         LOG(ERROR) << "DacControl: No ES9218 path found, exiting...";
         return;
     }
 
-    struct stat buffer;
-
     avcPath = std::string(COMMON_ES9218_PATH);
     avcPath.append(AVC_VOLUME);
     volumeLeftPath = std::string(COMMON_ES9218_PATH);
@@ -88,264 +85,121 @@ DacControl::DacControl() {
     customFilterPath = std::string(COMMON_ES9218_PATH);
     customFilterPath.append(ESS_CUSTOM_FILTER);
 
-    mAudioDevicesFactory_V6_0 = ::android::hardware::audio::V6_0::IDevicesFactory::getService();
-    if(mAudioDevicesFactory_V6_0 == nullptr) {
-        LOG(INFO) << "mAudioDevicesFactory_V6_0 null, trying V5_0";
-        mAudioDevicesFactory_V5_0 = ::android::hardware::audio::V5_0::IDevicesFactory::getService();
-
-        if(mAudioDevicesFactory_V5_0 == nullptr) {
-            LOG(ERROR) << "mAudioDevicesFactory_V5_0 null, aborting";
-            return;
-        } else {
-            usedVersion = AudioVersion::V5_0;
-        }
-    } else {
-        usedVersion = AudioVersion::V6_0;
+    if(!mDispatcher.connect()) {
+        LOG(ERROR) << "DacControl: No primary audio device, exiting...";
+        return;
     }
 
-    switch(usedVersion) {
-        case AudioVersion::V6_0: {
-                std::function<void(::android::hardware::audio::V6_0::Result,
-                    const android::sp<::android::hardware::audio::V6_0::IDevice>&)> openDevice_cb_V6_0 = [this](::android::hardware::audio::V6_0::Result result,
-                                                                    const android::sp<::android::hardware::audio::V6_0::IDevice>& device)
-                    {
-                        if(result == ::android::hardware::audio::V6_0::Result::OK) {
-                            this->mAudioDevice_V6_0 = device;
-                        } else {
-                            LOG(INFO) << "Couldnt open primary audio device";
-                        }
-                    };
-                mAudioDevicesFactory_V6_0->openDevice("primary", openDevice_cb_V6_0);
-
-                if(mAudioDevice_V6_0 == nullptr) {
-                    LOG(INFO) << "mAudioDevice_V6_0 null, aborting";
-                    return;
-                }
-            }
-            break;
-        case AudioVersion::V5_0: {
-                std::function<void(::android::hardware::audio::V5_0::Result,
-                    const android::sp<::android::hardware::audio::V5_0::IDevice>&)> openDevice_cb_V5_0 = [this](::android::hardware::audio::V5_0::Result result,
-                                                                    const android::sp<::android::hardware::audio::V5_0::IDevice>& device)
-                    {
-                        if(result == ::android::hardware::audio::V5_0::Result::OK) {
-                            this->mAudioDevice_V5_0 = device;
-                        } else {
-                            LOG(INFO) << "Couldnt open primary audio device";
-                        }
-                    };
-                mAudioDevicesFactory_V5_0->openDevice("primary", openDevice_cb_V5_0);
-
-                if(mAudioDevice_V5_0 == nullptr) {
-                    LOG(INFO) << "mAudioDevice_V5_0 null, aborting";
-                    return;
-                }
-            }
-            break;
-        default: return; // Should never reach this state
-    }
+    mCapabilities = std::move(capabilities);
 
     /* Quad DAC */
-    mSupportedFeatures.push_back(Feature::QuadDAC);
     setHifiDacState(getHifiDacState());
 
     /* Digital Filter */
-    if(stat(essFilterPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::DigitalFilter);
-        FeatureStates digfilter_fstates;
-        digfilter_fstates.states = hidl_vec<KeyValue> {digital_filters};
-        mSupportedStates.emplace(Feature::DigitalFilter, digfilter_fstates);
+    if(isSupported(Feature::DigitalFilter)) {
         setFeatureValue(Feature::DigitalFilter, getFeatureValue(Feature::DigitalFilter));
     }
 
-#ifdef PROPRIETARY_AUDIO_MODULE
     /* Sound Presets */
-    mSupportedFeatures.push_back(Feature::SoundPreset);
-    FeatureStates soundpresets_fstates;
-    soundpresets_fstates.states = hidl_vec<KeyValue> {sound_presets};
-    mSupportedStates.emplace(Feature::SoundPreset, soundpresets_fstates);
-    setFeatureValue(Feature::SoundPreset, getFeatureValue(Feature::SoundPreset));
-#endif
+    if(isSupported(Feature::SoundPreset)) {
+        setFeatureValue(Feature::SoundPreset, getFeatureValue(Feature::SoundPreset));
+    }
 
     /* Balance Left */
-    if(stat(volumeLeftPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::BalanceLeft);
-        FeatureStates balanceleft_fstates;
-        balanceleft_fstates.range.max = MAX_BALANCE_VALUE;
-        balanceleft_fstates.range.min = MIN_BALANCE_VALUE;
-        balanceleft_fstates.range.step = 1;
-        mSupportedStates.emplace(Feature::BalanceLeft, balanceleft_fstates);
+    if(isSupported(Feature::BalanceLeft)) {
         setFeatureValue(Feature::BalanceLeft, getFeatureValue(Feature::BalanceLeft));
     }
 
     /* Balance Right */
-    if(stat(volumeRightPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::BalanceRight);
-        FeatureStates balanceright_fstates;
-        balanceright_fstates.range.max = MAX_BALANCE_VALUE;
-        balanceright_fstates.range.min = MIN_BALANCE_VALUE;
-        balanceright_fstates.range.step = 1;
-        mSupportedStates.emplace(Feature::BalanceRight, balanceright_fstates);
+    if(isSupported(Feature::BalanceRight)) {
         setFeatureValue(Feature::BalanceRight, getFeatureValue(Feature::BalanceRight));
     }
 
     /* AVC Volume */
-    if(stat(avcPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::AVCVolume);
+    if(isSupported(Feature::AVCVolume)) {
         writeAvcVolumeState(getFeatureValue(Feature::AVCVolume));
     }
 
     /* Hi-Fi Mode setting */
-    if(stat(hifiPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::HifiMode);
+    if(isSupported(Feature::HifiMode)) {
         writeHifiModeState(getFeatureValue(Feature::HifiMode));
     }
 
     /* Custom ESS filter setting */
-    if(stat(customFilterPath.c_str(), &buffer) == 0) {
-        mSupportedFeatures.push_back(Feature::CustomFilter);
-        setCustomFilterShape(getCustomFilterShape());
-        setCustomFilterSymmetry(getCustomFilterSymmetry());
-        for(int i=0; i < 14; i++)
-            setCustomFilterCoeff(i, getCustomFilterCoeff(i));
-    }
-}
-
-Return<void> DacControl::getSupportedFeatures(getSupportedFeatures_cb _hidl_cb) {
-    
-    std::vector<Feature> ret;
-    for(auto entry : mSupportedFeatures) {
-        ret.push_back(entry);
+    if(isSupported(Feature::CustomFilter)) {
+        writeNode(customFilterPath, mState.getEncodedCustomFilter());
     }
-    _hidl_cb(ret);
-    
-    return Void();
 }
 
-FeatureStates DacControl::getAvcVolumeStates() {
-    FeatureStates states;
-    
-    states.range.min = -24;
-    states.range.max = 0;
-    states.range.step = 1;
-    
-    return states;
+bool DacControl::isSupported(Feature feature) const {
+    return mCapabilities.isSupported(feature);
 }
 
-FeatureStates DacControl::getHifiModeStates() {
-    FeatureStates states;
-    
-    states.states = hidl_vec<KeyValue> {hifi_modes};
-    
-    return states;
+Return<void> DacControl::getSupportedFeatures(getSupportedFeatures_cb _hidl_cb) {
+    _hidl_cb(mCapabilities.getSupportedFeatures());
+    return Void();
 }
 
 Return<void> DacControl::getSupportedFeatureValues(Feature feature, getSupportedFeatureValues_cb _hidl_cb) {
-    std::map<Feature, FeatureStates>::iterator it;
-
-    // Check for sysfs-based features; these do different things
-    switch(feature) {
-        case Feature::AVCVolume:
-            _hidl_cb(getAvcVolumeStates());
-            goto end;
-        case Feature::HifiMode:
-            _hidl_cb(getHifiModeStates());
-            goto end;
-        default:
-            break;
-    }
-    it = mSupportedStates.find(feature);
-    if (it != mSupportedStates.end()) {
-        _hidl_cb(it->second);
+    const FeatureStates* states = mCapabilities.getStates(feature);
+    if(states != nullptr) {
+        _hidl_cb(*states);
     } else {
         LOG(ERROR) << "DacControl::getSupportedFeatureValues: tried to get values for unsupported Feature...";
     }
-
-end:
     return Void();
 }
 
 bool DacControl::writeAvcVolumeState(int32_t value) {
-    set(avcPath, (-1)*value); //we save it as the actual value, while the kernel requires a positive value
-    return (bool)property_set(PROPERTY_HIFI_DAC_AVC_VOLUME, std::to_string(value).c_str());
+    writeNode(avcPath, (-1)*value); //we save it as the actual value, while the kernel requires a positive value
+    mState.set(DacState::KEY_AVC_VOLUME, value);
+    return true;
 }
 
 bool DacControl::writeHifiModeState(int32_t value) {
-    set(hifiPath, value);
-    return (bool)property_set(PROPERTY_HIFI_DAC_MODE, std::to_string(value).c_str());
-}
-
-bool DacControl::setAudioHALParameters(KeyValue kv) {
-    ::android::hardware::audio::V5_0::Result result_V5_0 = ::android::hardware::audio::V5_0::Result::NOT_SUPPORTED;
-    ::android::hardware::audio::V6_0::Result result_V6_0 = ::android::hardware::audio::V6_0::Result::NOT_SUPPORTED;
-
-    switch(usedVersion) {
-        case AudioVersion::V6_0:
-            {
-                std::vector<::android::hardware::audio::V6_0::ParameterValue> pv_vec = {{kv.name, kv.value}};
-                hidl_vec<::android::hardware::audio::V6_0::ParameterValue> parameters_V6_0 =
-                        hidl_vec<::android::hardware::audio::V6_0::ParameterValue> {pv_vec};
-                result_V6_0 = mAudioDevice_V6_0->setParameters({}, parameters_V6_0);
-            }
-            break;
-        case AudioVersion::V5_0:
-            {
-                std::vector<::android::hardware::audio::V5_0::ParameterValue> pv_vec = {{kv.name, kv.value}};
-                hidl_vec<::android::hardware::audio::V5_0::ParameterValue> parameters_V5_0 =
-                        hidl_vec<::android::hardware::audio::V5_0::ParameterValue> {pv_vec};
-                result_V5_0 = mAudioDevice_V5_0->setParameters({}, parameters_V5_0);
-            }
-            break;
-        default:
-            return false;
-    }
-
-    if(result_V5_0 == ::android::hardware::audio::V5_0::Result::OK ||
-       result_V6_0 == ::android::hardware::audio::V6_0::Result::OK)
-        return true;
-
-    // Should not reach this point
-    return false;
+    writeNode(hifiPath, value);
+    mState.set(DacState::KEY_HIFI_MODE, value);
+    return true;
 }
 
 Return<bool> DacControl::setHifiDacState(bool enable) {
     KeyValue kv;
     kv.name = DAC_COMMAND;
     kv.value = enable ? SET_DAC_ON_COMMAND : SET_DAC_OFF_COMMAND;
-    return setAudioHALParameters(kv);
+    return mDispatcher.send(kv);
 }
 
 bool DacControl::setDigitalFilterState(int32_t value) {
     switch(value) {
         case 0: // Short
-            set(essFilterPath, 9);
+            writeNode(essFilterPath, 9);
             break;
         case 1: // Sharp
-            set(essFilterPath, 4);
+            writeNode(essFilterPath, 4);
             break;
         case 2: // Slow
-            set(essFilterPath, 5);
+            writeNode(essFilterPath, 5);
             break;
         case 3: // Custom
-            set(essFilterPath, 3);
+            writeNode(essFilterPath, 3);
             break;
         default:
             LOG(ERROR) << "DacControl::setDigitalFilterState: Invalid filter " << value;
             return false;
     }
-    property_set(PROPERTY_DIGITAL_FILTER, std::to_string(value).c_str());
+    mState.set(DacState::KEY_DIGITAL_FILTER, value);
     return true;
 }
 
 bool DacControl::setVolumeBalance(Feature direction, int32_t value) {
     switch(direction) {
         case Feature::BalanceLeft:
-            set(volumeLeftPath, value);
-            property_set(PROPERTY_LEFT_BALANCE, std::to_string(value).c_str());
+            writeNode(volumeLeftPath, value);
+            mState.set(DacState::KEY_BALANCE_LEFT, value);
             return true;
         case Feature::BalanceRight:
-            set(volumeRightPath, value);
-            property_set(PROPERTY_RIGHT_BALANCE, std::to_string(value).c_str());
+            writeNode(volumeRightPath, value);
+            mState.set(DacState::KEY_BALANCE_RIGHT, value);
             return true;
         default:
             return false;
@@ -354,22 +208,18 @@ bool DacControl::setVolumeBalance(Feature direction, int32_t value) {
 
 Return<bool> DacControl::setFeatureValue(Feature feature, int32_t value) {
 
-    bool rc;
-
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), feature) == mSupportedFeatures.end()) {
+    if(!isSupported(feature)) {
         LOG(ERROR) << "DacControl::setFeatureValue: tried to set value for unsupported Feature...";
         return false;
     }
 
     KeyValue kv;
-    std::string property;
     switch(feature) {
         case Feature::DigitalFilter: {
             return setDigitalFilterState(value);
         }
         case Feature::SoundPreset: {
             kv.name = SET_SOUND_PRESET_COMMAND;
-            property = PROPERTY_SOUND_PRESET;
             break;
         }
         case Feature::BalanceLeft:
@@ -387,168 +237,124 @@ Return<bool> DacControl::setFeatureValue(Feature feature, int32_t value) {
     kv.value = std::to_string(value);
 
 #ifdef PROPRIETARY_AUDIO_MODULE
-    rc = setAudioHALParameters(kv);
-#else
-    rc = true;
+    // Presets are flicked through from the UI, let the dispatcher batch them
+    mDispatcher.post(kv);
 #endif
 
-    if(rc) {
-        property_set(property.c_str(), kv.value.c_str());
-        return true;
-    } else {
-        return false;
-    }
+    mState.set(DacState::KEY_SOUND_PRESET, value);
+    return true;
 }
 
 Return<bool> DacControl::getHifiDacState() {
+#ifndef PROPRIETARY_AUDIO_MODULE
+    // Same state the audio HAL routes from
+    return dac_hifi_wanted(&mDac);
+#else
     char value[PROPERTY_VALUE_MAX];
     property_get(PROPERTY_HIFI_DAC_ENABLED, value, PROPERTY_VALUE_HIFI_DAC_DISABLED);
     return (strcmp(value, PROPERTY_VALUE_HIFI_DAC_ENABLED) == 0);
+#endif
 }
 
 Return<int32_t> DacControl::getFeatureValue(Feature feature) {
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), feature) == mSupportedFeatures.end()) {
+    if(!isSupported(feature)) {
         LOG(ERROR) << "DacControl::getFeatureValue: tried to set value for unsupported Feature...";
         return -1;
     }
 
-    int32_t property_default_value = 0;
-    std::string property;
-    char value[PROPERTY_VALUE_MAX];
-
     switch(feature) {
-        case Feature::DigitalFilter: {
-            property = PROPERTY_DIGITAL_FILTER;
-            break;
-        }
-        case Feature::SoundPreset: {
-            property = PROPERTY_SOUND_PRESET;
-            break;
-        }
-        case Feature::BalanceLeft: {
-            property = PROPERTY_LEFT_BALANCE;
-            break;
-        }
-        case Feature::BalanceRight: {
-            property = PROPERTY_RIGHT_BALANCE;
-            break;
-        }
-        case Feature::AVCVolume: {
-            property = PROPERTY_HIFI_DAC_AVC_VOLUME;
-            property_default_value = AVC_VOLUME_DEFAULT;
-            break;
-        }
-        case Feature::HifiMode: {
-            property = PROPERTY_HIFI_DAC_MODE;
-            property_default_value = HIFI_MODE_DEFAULT;
-            break;
-        }
+        case Feature::DigitalFilter:
+            return mState.get(DacState::KEY_DIGITAL_FILTER);
+        case Feature::SoundPreset:
+            return mState.get(DacState::KEY_SOUND_PRESET);
+        case Feature::BalanceLeft:
+            return mState.get(DacState::KEY_BALANCE_LEFT);
+        case Feature::BalanceRight:
+            return mState.get(DacState::KEY_BALANCE_RIGHT);
+        case Feature::AVCVolume:
+            return mState.get(DacState::KEY_AVC_VOLUME);
+        case Feature::HifiMode:
+            return mState.get(DacState::KEY_HIFI_MODE);
         default:
             return false;
     }
-    property_get(property.c_str(), value, std::to_string(property_default_value).c_str());
-    return std::stoi(value);
 }
 
 // Custom filter implementation
 
 Return<int32_t> DacControl::getCustomFilterShape(void) {
-    return property_get_int32(PROPERTY_CUSTOM_FILTER_SHAPE, 0);
+    return mState.getCustomFilter().shape;
 }
 
 Return<int32_t> DacControl::getCustomFilterSymmetry(void) {
-    return property_get_int32(PROPERTY_CUSTOM_FILTER_SYMMETRY, 0);
+    return mState.getCustomFilter().symmetry;
 }
 
 Return<int32_t> DacControl::getCustomFilterCoeff(int32_t coeffIndex) {
-    return property_get_int32(PROPERTY_CUSTOM_FILTER_COEFFS.at(coeffIndex).c_str(), 0);
+    if(coeffIndex < 0 || coeffIndex >= CUSTOM_FILTER_COEFFS_COUNT) {
+        LOG(ERROR) << "DacControl::getCustomFilterCoeff: invalid coefficient index " << coeffIndex;
+        return 0;
+    }
+    return mState.getCustomFilter().coeffs[coeffIndex];
 }
 
-std::string DacControl::parseUpdatedCustomFilterData() {
-    std::string filter_data;
-
-    /*
-    * Let's build the actual string with the custom filter's shape, symmetry and 14 Stage 2 coefficients
-    *
-    */
-    filter_data.append(std::to_string(getCustomFilterShape())).append(",");
-    filter_data.append(std::to_string(getCustomFilterSymmetry())).append(",");
-    for (int i = 0; i < 14; i++) {
-        filter_data.append(std::to_string(getCustomFilterCoeff(i)));
-        if(i < 13) /* Last element doesn't need to have a comma appended after it */
-            filter_data.append(",");
+bool DacControl::updateCustomFilter(const CustomFilter& filter) {
+    if(mState.setCustomFilter(filter)) {
+        writeNode(customFilterPath, mState.getEncodedCustomFilter());
     }
-
-    return filter_data;
+    return true;
 }
 
 Return<bool> DacControl::setCustomFilterShape(int32_t shape) {
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), Feature::CustomFilter) == mSupportedFeatures.end()) {
+    if(!isSupported(Feature::CustomFilter)) {
         LOG(ERROR) << "DacControl::setCustomFilterShape: tried to set custom filter control on unsupported device";
         return false;
     }
 
-    int rc;
+    CustomFilter filter = mState.getCustomFilter();
     if(shape <= 4)
-        rc = property_set(PROPERTY_CUSTOM_FILTER_SHAPE, std::to_string(shape).c_str());
+        filter.shape = shape;
     else /* Filter 5 (counting from 0) is enumerated 6 on es9218.h, so anything after receives +1 as well */
-        rc = property_set(PROPERTY_CUSTOM_FILTER_SHAPE, std::to_string(shape + 1).c_str());
-    if (rc) {
-        LOG(ERROR) << "DacControl::setCustomFilterShape: failed to set property " << PROPERTY_CUSTOM_FILTER_SHAPE << " with error " << rc;
-        return false;
-    }
-    set(customFilterPath, parseUpdatedCustomFilterData());
-    return true;
+        filter.shape = shape + 1;
+    return updateCustomFilter(filter);
 }
 
 Return<bool> DacControl::setCustomFilterSymmetry(int symmetry) {
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), Feature::CustomFilter) == mSupportedFeatures.end()) {
+    if(!isSupported(Feature::CustomFilter)) {
         LOG(ERROR) << "DacControl::setCustomFilterSymmetry: tried to set custom filter control on unsupported device";
         return false;
     }
 
-    int rc = property_set(PROPERTY_CUSTOM_FILTER_SYMMETRY, std::to_string(symmetry).c_str());
-    if (rc) {
-        LOG(ERROR) << "DacControl::setCustomFilterSymmetry: failed to set property " << PROPERTY_CUSTOM_FILTER_SYMMETRY << " with error " << rc;
-        return false;
-    }
-    set(customFilterPath, parseUpdatedCustomFilterData());
-    return true;
+    CustomFilter filter = mState.getCustomFilter();
+    filter.symmetry = symmetry;
+    return updateCustomFilter(filter);
 }
 
 Return<bool> DacControl::setCustomFilterCoeff(int coeffIndex, int value) {
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), Feature::CustomFilter) == mSupportedFeatures.end()) {
+    if(!isSupported(Feature::CustomFilter)) {
         LOG(ERROR) << "DacControl::setCustomFilterCoeff: tried to set custom filter control on unsupported device";
         return false;
     }
 
-    int rc = property_set(PROPERTY_CUSTOM_FILTER_COEFFS.at(coeffIndex).c_str(), std::to_string(value).c_str());
-    if (rc) {
-        LOG(ERROR) << "DacControl::setCustomFilterCoeff: failed to set property " << PROPERTY_CUSTOM_FILTER_COEFFS.at(coeffIndex) << " with error " << rc;
+    if(coeffIndex < 0 || coeffIndex >= CUSTOM_FILTER_COEFFS_COUNT) {
+        LOG(ERROR) << "DacControl::setCustomFilterCoeff: invalid coefficient index " << coeffIndex;
         return false;
     }
-    set(customFilterPath, parseUpdatedCustomFilterData());
-    return true;
+
+    CustomFilter filter = mState.getCustomFilter();
+    filter.coeffs[coeffIndex] = value;
+    return updateCustomFilter(filter);
 }
 
 Return<bool> DacControl::resetCustomFilterCoeffs() {
-    int rc;
-
-    if(std::find(mSupportedFeatures.begin(), mSupportedFeatures.end(), Feature::CustomFilter) == mSupportedFeatures.end()) {
+    if(!isSupported(Feature::CustomFilter)) {
         LOG(ERROR) << "DacControl::setCustomFilterCoeff: tried to set custom filter control on unsupported device";
         return false;
     }
 
-    for (int i = 0; i < 14; i++) {
-        rc = property_set(PROPERTY_CUSTOM_FILTER_COEFFS.at(i).c_str(), "0");
-        if(rc) {
-            LOG(ERROR) << "DacControl::resetCustomFilterCoeff: failed to set property " << PROPERTY_CUSTOM_FILTER_COEFFS.at(i) << " with error " << rc;
-            return false;
-        }
-    }
-    set(customFilterPath, parseUpdatedCustomFilterData());
-
-    return true;
+    CustomFilter filter = mState.getCustomFilter();
+    filter.coeffs.fill(0);
+    return updateCustomFilter(filter);
 }
 
 }  // namespace implementation
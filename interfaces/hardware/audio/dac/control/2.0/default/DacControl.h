@@ -18,16 +18,15 @@
 
 #include <vendor/lge/hardware/audio/dac/control/2.0/IDacControl.h>
 
-#include <android/hardware/audio/5.0/IDevice.h>
-#include <android/hardware/audio/5.0/IDevicesFactory.h>
-#include <android/hardware/audio/6.0/IDevice.h>
-#include <android/hardware/audio/6.0/IDevicesFactory.h>
-
 #include <map>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
+#include "AudioParameterDispatcher.h"
 #include "Constants.h"
+#include "DacCapabilities.h"
+#include "DacState.h"
 
 namespace vendor {
 namespace lge {
@@ -46,11 +45,9 @@ using ::vendor::lge::hardware::audio::dac::control::V2_0::Feature;
 using ::vendor::lge::hardware::audio::dac::control::V2_0::FeatureStates;
 using ::vendor::lge::hardware::audio::dac::control::V2_0::FeatureState;
 
-enum AudioVersion { V5_0, V6_0 };
-
 class DacControl : public IDacControl {
   public:
-    DacControl();
+    explicit DacControl(std::unique_ptr<DacProbe> probe = std::make_unique<BackendDacProbe>());
 
     Return<void> getSupportedFeatures(getSupportedFeatures_cb _hidl_cb) override;
 
@@ -78,32 +75,32 @@ class DacControl : public IDacControl {
 
     Return<bool> resetCustomFilterCoeffs() override;
 
-    std::map<Feature, FeatureStates> mSupportedStates;
-    std::vector<Feature> mSupportedFeatures;
-
   private:
-    FeatureStates getAvcVolumeStates();
-    FeatureStates getHifiModeStates();
+    bool isSupported(Feature feature) const;
+
     bool writeAvcVolumeState(int32_t value);
     bool writeHifiModeState(int32_t value);
-    bool setAudioHALParameters(KeyValue kv);
     bool setDigitalFilterState(int32_t value);
     bool setVolumeBalance(Feature direction, int32_t value);
-    std::string parseUpdatedCustomFilterData();
+    bool updateCustomFilter(const CustomFilter& filter);
+    void writeNode(const std::string& path, const std::string& value);
+    void writeNode(const std::string& path, int32_t value);
+
+    AudioParameterDispatcher mDispatcher;
 
-    android::sp<::android::hardware::audio::V5_0::IDevice> mAudioDevice_V5_0;
-    android::sp<::android::hardware::audio::V5_0::IDevicesFactory> mAudioDevicesFactory_V5_0;
-    android::sp<::android::hardware::audio::V6_0::IDevice> mAudioDevice_V6_0;
-    android::sp<::android::hardware::audio::V6_0::IDevicesFactory> mAudioDevicesFactory_V6_0;
+    DacCapabilities mCapabilities;
+    dac_state_t mDac;
 
-    AudioVersion usedVersion;
-  
     std::string avcPath;
     std::string hifiPath;
     std::string volumeLeftPath;
     std::string volumeRightPath;
     std::string essFilterPath;
     std::string customFilterPath;
+
+    DacState mState;
+    // Last value written to each sysfs node
+    std::map<std::string, std::string> mNodeValues;
 };
 
 }  // namespace implementation
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DacState.h"
+
+#include <android-base/logging.h>
+#include <cutils/properties.h>
+
+#include <vector>
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+/* Time to wait for more changes before persisting a batch */
+static constexpr std::chrono::milliseconds PERSIST_DELAY(500);
+
+static const char* propertyForKey(DacState::Key key) {
+    switch(key) {
+        case DacState::KEY_DIGITAL_FILTER:
+            return PROPERTY_DIGITAL_FILTER;
+        case DacState::KEY_SOUND_PRESET:
+            return PROPERTY_SOUND_PRESET;
+        case DacState::KEY_BALANCE_LEFT:
+            return PROPERTY_LEFT_BALANCE;
+        case DacState::KEY_BALANCE_RIGHT:
+            return PROPERTY_RIGHT_BALANCE;
+        case DacState::KEY_AVC_VOLUME:
+            return PROPERTY_HIFI_DAC_AVC_VOLUME;
+        case DacState::KEY_HIFI_MODE:
+        default:
+            return PROPERTY_HIFI_DAC_MODE;
+    }
+}
+
+static int32_t defaultForKey(DacState::Key key) {
+    switch(key) {
+        case DacState::KEY_AVC_VOLUME:
+            return AVC_VOLUME_DEFAULT;
+        case DacState::KEY_HIFI_MODE:
+            return HIFI_MODE_DEFAULT;
+        default:
+            return 0;
+    }
+}
+
+DacState::DacState() {
+    for(int i = 0; i < KEY_COUNT; i++) {
+        Key key = static_cast<Key>(i);
+        mValues[i] = property_get_int32(propertyForKey(key), defaultForKey(key));
+    }
+    loadCustomFilter();
+
+    mThread = std::thread(&DacState::persistLoop, this);
+}
+
+DacState::~DacState() {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQuit = true;
+    }
+    mCond.notify_one();
+    mThread.join();
+}
+
+int32_t DacState::get(Key key) {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mValues[key];
+}
+
+bool DacState::set(Key key, int32_t value) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if(mValues[key] == value) {
+            return false;
+        }
+        mValues[key] = value;
+        mDirty.set(key);
+    }
+    mCond.notify_one();
+    return true;
+}
+
+void DacState::loadCustomFilter() {
+    char value[PROPERTY_VALUE_MAX];
+
+    if(property_get(PROPERTY_CUSTOM_FILTER, value, "") <= 0 ||
+       !CustomFilter::decode(value, &mCustomFilter)) {
+        /* Fall back to the per-field properties older builds used */
+        mCustomFilter.shape = property_get_int32(PROPERTY_CUSTOM_FILTER_SHAPE, 0);
+        mCustomFilter.symmetry = property_get_int32(PROPERTY_CUSTOM_FILTER_SYMMETRY, 0);
+        for(int i = 0; i < CUSTOM_FILTER_COEFFS_COUNT; i++) {
+            mCustomFilter.coeffs[i] = property_get_int32(PROPERTY_CUSTOM_FILTER_COEFFS.at(i).c_str(), 0);
+        }
+    }
+    mEncodedCustomFilter = mCustomFilter.encode();
+}
+
+CustomFilter DacState::getCustomFilter() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mCustomFilter;
+}
+
+bool DacState::setCustomFilter(const CustomFilter& filter) {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if(mCustomFilter == filter) {
+            return false;
+        }
+        mCustomFilter = filter;
+        mEncodedCustomFilter = filter.encode();
+        mCustomFilterDirty = true;
+    }
+    mCond.notify_one();
+    return true;
+}
+
+std::string DacState::getEncodedCustomFilter() {
+    std::lock_guard<std::mutex> lock(mLock);
+    return mEncodedCustomFilter;
+}
+
+void DacState::persistCustomFilter(const CustomFilter& filter, const std::string& encoded) {
+    if(encoded.size() < PROPERTY_VALUE_MAX) {
+        int rc = property_set(PROPERTY_CUSTOM_FILTER, encoded.c_str());
+        if(rc) {
+            LOG(ERROR) << "DacState: failed to set property " << PROPERTY_CUSTOM_FILTER
+                       << " with error " << rc;
+        }
+        return;
+    }
+
+    /* Too long for a single property, spread it over the per-field ones */
+    property_set(PROPERTY_CUSTOM_FILTER, "");
+    property_set(PROPERTY_CUSTOM_FILTER_SHAPE, std::to_string(filter.shape).c_str());
+    property_set(PROPERTY_CUSTOM_FILTER_SYMMETRY, std::to_string(filter.symmetry).c_str());
+    for(int i = 0; i < CUSTOM_FILTER_COEFFS_COUNT; i++) {
+        property_set(PROPERTY_CUSTOM_FILTER_COEFFS.at(i).c_str(),
+                     std::to_string(filter.coeffs[i]).c_str());
+    }
+}
+
+void DacState::persistLocked(std::unique_lock<std::mutex>& lock) {
+    std::vector<std::pair<Key, int32_t>> batch;
+    for(int i = 0; i < KEY_COUNT; i++) {
+        if(mDirty.test(i)) {
+            batch.emplace_back(static_cast<Key>(i), mValues[i]);
+        }
+    }
+    mDirty.reset();
+
+    bool persistFilter = mCustomFilterDirty;
+    CustomFilter filter = mCustomFilter;
+    std::string encoded = mEncodedCustomFilter;
+    mCustomFilterDirty = false;
+
+    lock.unlock();
+    if(persistFilter) {
+        persistCustomFilter(filter, encoded);
+    }
+    for(const auto& [key, value] : batch) {
+        int rc = property_set(propertyForKey(key), std::to_string(value).c_str());
+        if(rc) {
+            LOG(ERROR) << "DacState: failed to set property " << propertyForKey(key)
+                       << " with error " << rc;
+        }
+    }
+    lock.lock();
+}
+
+void DacState::persistLoop() {
+    std::unique_lock<std::mutex> lock(mLock);
+    for(;;) {
+        mCond.wait(lock, [this] { return mDirty.any() || mCustomFilterDirty || mQuit; });
+        if(!mQuit) {
+            // Let the rest of a burst land before persisting
+            mCond.wait_for(lock, PERSIST_DELAY, [this] { return mQuit; });
+        }
+        // Flush what is pending even when quitting
+        persistLocked(lock);
+        if(mQuit) {
+            return;
+        }
+    }
+}
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Constants.h"
+#include "CustomFilter.h"
+
+namespace vendor {
+namespace lge {
+namespace hardware {
+namespace audio {
+namespace dac {
+namespace control {
+namespace V2_0 {
+namespace implementation {
+
+/*
+ * In-memory copy of every persisted DAC setting.
+ *
+ * Values are loaded from their properties once, served from memory afterwards, and
+ * written back from a background thread in batches, so a slider dragged across its
+ * range costs one property_set() per setting instead of one per tick. The custom filter
+ * is kept as a whole and persisted as a single encoded value.
+ */
+class DacState {
+  public:
+    enum Key {
+        KEY_DIGITAL_FILTER,
+        KEY_SOUND_PRESET,
+        KEY_BALANCE_LEFT,
+        KEY_BALANCE_RIGHT,
+        KEY_AVC_VOLUME,
+        KEY_HIFI_MODE,
+        KEY_COUNT,
+    };
+
+    DacState();
+    ~DacState();
+
+    int32_t get(Key key);
+    // Returns whether the value changed.
+    bool set(Key key, int32_t value);
+
+    CustomFilter getCustomFilter();
+    // Returns whether the filter changed.
+    bool setCustomFilter(const CustomFilter& filter);
+    // The filter in the format expected by the driver.
+    std::string getEncodedCustomFilter();
+
+  private:
+    void persistLoop();
+    void persistLocked(std::unique_lock<std::mutex>& lock);
+    void loadCustomFilter();
+    static void persistCustomFilter(const CustomFilter& filter, const std::string& encoded);
+
+    std::mutex mLock;
+    std::condition_variable mCond;
+    std::array<int32_t, KEY_COUNT> mValues;
+    std::bitset<KEY_COUNT> mDirty;
+    CustomFilter mCustomFilter;
+    std::string mEncodedCustomFilter;
+    bool mCustomFilterDirty = false;
+    bool mQuit = false;
+    std::thread mThread;
+};
+
+}  // namespace implementation
+}  // namespace V2_0
+}  // namespace control
+}  // namespace dac
+}  // namespace audio
+}  // namespace hardware
+}  // namespace lge
+}  // namespace vendor
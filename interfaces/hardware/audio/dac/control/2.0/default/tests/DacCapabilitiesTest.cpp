@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 The LineageOS Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DacCapabilities.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "Constants.h"
+
+using namespace ::vendor::lge::hardware::audio::dac::control::V2_0;
+using namespace ::vendor::lge::hardware::audio::dac::control::V2_0::implementation;
+
+namespace {
+
+class FakeDacProbe : public DacProbe {
+  public:
+    FakeDacProbe(std::set<std::string> nodes, bool soundPresets)
+        : mNodes(std::move(nodes)), mSoundPresets(soundPresets) {}
+
+    bool hasNode(const std::string& node) override { return mNodes.count(node) > 0; }
+    bool hasSoundPresets() override { return mSoundPresets; }
+
+  private:
+    std::set<std::string> mNodes;
+    bool mSoundPresets;
+};
+
+const std::set<std::string> kAllNodes = {
+    "", ESS_FILTER, VOLUME_LEFT, VOLUME_RIGHT, AVC_VOLUME, HIFI_MODE, ESS_CUSTOM_FILTER,
+};
+
+std::vector<Feature> supportedFeatures(const DacCapabilities& caps) {
+    const auto& features = caps.getSupportedFeatures();
+    return std::vector<Feature>(features.begin(), features.end());
+}
+
+TEST(DacCapabilitiesTest, NothingWithoutDriver) {
+    FakeDacProbe probe({ESS_FILTER, AVC_VOLUME, HIFI_MODE}, true);
+    DacCapabilities caps(probe);
+
+    EXPECT_TRUE(supportedFeatures(caps).empty());
+    EXPECT_FALSE(caps.isSupported(Feature::QuadDAC));
+    EXPECT_FALSE(caps.isSupported(Feature::SoundPreset));
+    EXPECT_EQ(caps.getStates(Feature::HifiMode), nullptr);
+}
+
+TEST(DacCapabilitiesTest, AllFeatures) {
+    FakeDacProbe probe(kAllNodes, true);
+    DacCapabilities caps(probe);
+
+    std::vector<Feature> expected = {
+        Feature::QuadDAC,   Feature::DigitalFilter, Feature::SoundPreset, Feature::BalanceLeft,
+        Feature::BalanceRight, Feature::AVCVolume,  Feature::HifiMode,    Feature::CustomFilter,
+    };
+    EXPECT_EQ(supportedFeatures(caps), expected);
+    for (Feature feature : expected) {
+        EXPECT_TRUE(caps.isSupported(feature)) << toString(feature);
+    }
+
+    // Features without values have no states to report
+    EXPECT_EQ(caps.getStates(Feature::QuadDAC), nullptr);
+    EXPECT_EQ(caps.getStates(Feature::CustomFilter), nullptr);
+
+    ASSERT_NE(caps.getStates(Feature::DigitalFilter), nullptr);
+    EXPECT_EQ(caps.getStates(Feature::DigitalFilter)->states.size(), 3u);
+    ASSERT_NE(caps.getStates(Feature::SoundPreset), nullptr);
+    EXPECT_EQ(caps.getStates(Feature::SoundPreset)->states.size(), 5u);
+
+    for (Feature balance : {Feature::BalanceLeft, Feature::BalanceRight}) {
+        const FeatureStates* states = caps.getStates(balance);
+        ASSERT_NE(states, nullptr);
+        EXPECT_TRUE(states->states.size() == 0);
+        EXPECT_EQ(states->range.min, -12);
+        EXPECT_EQ(states->range.max, 0);
+        EXPECT_EQ(states->range.step, 1);
+    }
+}
+
+TEST(DacCapabilitiesTest, MissingNodes) {
+    FakeDacProbe probe({"", VOLUME_LEFT}, false);
+    DacCapabilities caps(probe);
+
+    std::vector<Feature> expected = {Feature::QuadDAC, Feature::BalanceLeft};
+    EXPECT_EQ(supportedFeatures(caps), expected);
+
+    EXPECT_FALSE(caps.isSupported(Feature::DigitalFilter));
+    EXPECT_FALSE(caps.isSupported(Feature::SoundPreset));
+    EXPECT_FALSE(caps.isSupported(Feature::BalanceRight));
+    EXPECT_FALSE(caps.isSupported(Feature::CustomFilter));
+    EXPECT_EQ(caps.getStates(Feature::DigitalFilter), nullptr);
+    EXPECT_EQ(caps.getStates(Feature::SoundPreset), nullptr);
+}
+
+TEST(DacCapabilitiesTest, AvcVolumeAndHifiModeFollowTheirNodes) {
+    // Both used to report their values whether or not the device had the node
+    FakeDacProbe without({"", ESS_FILTER}, true);
+    DacCapabilities capsWithout(without);
+    EXPECT_FALSE(capsWithout.isSupported(Feature::AVCVolume));
+    EXPECT_FALSE(capsWithout.isSupported(Feature::HifiMode));
+    EXPECT_EQ(capsWithout.getStates(Feature::AVCVolume), nullptr);
+    EXPECT_EQ(capsWithout.getStates(Feature::HifiMode), nullptr);
+
+    FakeDacProbe with({"", AVC_VOLUME, HIFI_MODE}, false);
+    DacCapabilities capsWith(with);
+
+    const FeatureStates* avc = capsWith.getStates(Feature::AVCVolume);
+    ASSERT_NE(avc, nullptr);
+    EXPECT_TRUE(avc->states.size() == 0);
+    EXPECT_EQ(avc->range.min, -24);
+    EXPECT_EQ(avc->range.max, 0);
+    EXPECT_EQ(avc->range.step, 1);
+
+    const FeatureStates* hifi = capsWith.getStates(Feature::HifiMode);
+    ASSERT_NE(hifi, nullptr);
+    ASSERT_EQ(hifi->states.size(), 3u);
+    EXPECT_EQ(hifi->states[0].name, "Normal");
+    EXPECT_EQ(hifi->states[0].value, "0");
+    EXPECT_EQ(hifi->states[2].name, "AUX High Impedance");
+    EXPECT_EQ(hifi->states[2].value, "2");
+}
+
+TEST(DacCapabilitiesTest, OutOfRangeFeatures) {
+    FakeDacProbe probe(kAllNodes, true);
+    DacCapabilities caps(probe);
+
+    for (int32_t value : {-1, static_cast<int32_t>(Feature::CustomFilter) + 1, 1000, INT32_MIN}) {
+        Feature feature = static_cast<Feature>(value);
+        EXPECT_FALSE(caps.isSupported(feature)) << value;
+        EXPECT_EQ(caps.getStates(feature), nullptr) << value;
+    }
+}
+
+TEST(DacCapabilitiesTest, DefaultIsEmpty) {
+    DacCapabilities caps;
+
+    EXPECT_TRUE(supportedFeatures(caps).empty());
+    EXPECT_FALSE(caps.isSupported(Feature::QuadDAC));
+}
+
+}  // namespace